@@ -3,6 +3,7 @@
 
 #include <istream>
 #include "FlowNetwork.h"
+#include "EdgeList.h"
 
 class AdjacencyListFlowNetwork : public FlowNetwork {
 public:
@@ -26,6 +27,24 @@ public:
         }
     }
 
+    // create flow network from an edge list with capacities (see EdgeListLoader.h) with exactly reserved adjacency vectors
+    explicit AdjacencyListFlowNetwork(const EdgeList& edgeList)
+            : numV(edgeList.numV), numE(edgeList.numE),
+              edgesByVertex(edgeList.numV, std::vector<std::shared_ptr<FlowEdge>>{}) {
+        if (!edgeList.hasWeights) throw std::invalid_argument("Edge list has no capacities");
+        for (int v = 0; v < numV; ++v) {
+            edgesByVertex[v].reserve(edgeList.outDegree[v] + edgeList.inDegree[v]);
+        }
+        for (int i = 0; i < numE; ++i) {
+            const int fromVertex = edgeList.endpoints[2 * i];
+            const int toVertex = edgeList.endpoints[2 * i + 1];
+            const double capacity = edgeList.weights[i];
+            if (capacity <= 0) throw std::invalid_argument("Cannot create flow edge v->w");
+            edgesByVertex[fromVertex].emplace_back(std::make_shared<FlowEdge>(fromVertex, toVertex, capacity));
+            edgesByVertex[toVertex].emplace_back(edgesByVertex[fromVertex].back());
+        }
+    }
+
     void addEdge(const FlowEdge& e) override {
         const int fromVertex = e.from();
         const int toVertex = e.to();
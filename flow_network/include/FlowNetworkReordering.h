@@ -0,0 +1,56 @@
+#ifndef WEIGHTED_GRAPHS_CPP_FLOWNETWORKREORDERING_H
+#define WEIGHTED_GRAPHS_CPP_FLOWNETWORKREORDERING_H
+
+#include <algorithm>
+#include "AdjacencyListFlowNetwork.h"
+#include "VertexReordering.h"
+
+// adjacencies of network as compressed sparse rows (every edge is in adj() of both of its vertices)
+inline CompressedSparseRows toRows(const FlowNetwork& network) {
+    std::vector<size_t> offsets(static_cast<size_t>(network.V()) + 1, 0);
+    for (int v = 0; v < network.V(); ++v) {
+        offsets[v + 1] = offsets[v] + network.adj(v).size();
+    }
+    std::vector<int> targets{};
+    targets.reserve(offsets.back());
+    for (int v = 0; v < network.V(); ++v) {
+        for (const auto& edge : network.adj(v)) {
+            targets.push_back(edge->other(v));
+        }
+    }
+    return CompressedSparseRows(std::move(offsets), std::move(targets));
+}
+
+// compute a cache-friendly vertex order of network, ignoring edge directions (see VertexReordering.h)
+inline VertexPermutation computeVertexOrder(const FlowNetwork& network, const VertexOrder order) {
+    return computeVertexOrder(toRows(network), order);
+}
+
+// copy of network (capacities without flows) where vertex v is called permutation.toNew(v)
+// edges are added by ascending new IDs of their start and end vertices
+inline AdjacencyListFlowNetwork relabel(const FlowNetwork& network, const VertexPermutation& permutation) {
+    if (permutation.size() != network.V()) throw std::invalid_argument("Permutation does not match flow network");
+    std::vector<FlowEdge> edges{};
+    edges.reserve(network.E());
+    for (int v = 0; v < network.V(); ++v) {
+        bool selfLoopOpen = false; // self-loops are in adj(v) twice
+        for (const auto& edge : network.adj(v)) {
+            if (edge->from() != v) continue; // take each edge at its start vertex only
+            if (edge->to() == v) {
+                selfLoopOpen = !selfLoopOpen;
+                if (!selfLoopOpen) continue;
+            }
+            edges.emplace_back(permutation.toNew(v), permutation.toNew(edge->to()), edge->capacity());
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const FlowEdge& lhs, const FlowEdge& rhs) {
+        return lhs.from() != rhs.from() ? lhs.from() < rhs.from() : lhs.to() < rhs.to();
+    });
+    AdjacencyListFlowNetwork result(network.V());
+    for (const auto& edge : edges) {
+        result.addEdge(edge);
+    }
+    return result;
+}
+
+#endif //WEIGHTED_GRAPHS_CPP_FLOWNETWORKREORDERING_H
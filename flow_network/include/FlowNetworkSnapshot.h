@@ -0,0 +1,40 @@
+#ifndef WEIGHTED_GRAPHS_CPP_FLOWNETWORKSNAPSHOT_H
+#define WEIGHTED_GRAPHS_CPP_FLOWNETWORKSNAPSHOT_H
+
+#include "AdjacencyListFlowNetwork.h"
+#include "GraphSnapshot.h"
+
+// write binary snapshot of the edges and capacities of network to path (see GraphSnapshot.h)
+// every edge is saved once in the row of its start vertex, flows are not saved
+inline void writeSnapshot(const FlowNetwork& network, const std::string& path) {
+    // call fn(edge) for every edge starting at v (self-loops are in adj(v) twice)
+    const auto forEachEdgeFrom = [&](const int v, const auto& fn) {
+        bool selfLoopOpen = false;
+        for (const auto& edge : network.adj(v)) {
+            if (edge->from() != v) continue;
+            if (edge->to() == v) {
+                selfLoopOpen = !selfLoopOpen;
+                if (!selfLoopOpen) continue;
+            }
+            fn(*edge);
+        }
+    };
+    writeSnapshotFile(path, SnapshotType::FlowNetwork, network.V(), network.E(),
+                      [&](const int v) {
+                          size_t num = 0;
+                          forEachEdgeFrom(v, [&](const FlowEdge&) { ++num; });
+                          return num;
+                      },
+                      [&](const int v, const auto& write) {
+                          forEachEdgeFrom(v, [&](const FlowEdge& edge) {
+                              write(SnapshotEdgeEntry{edge.from(), edge.to(), edge.capacity()});
+                          });
+                      });
+}
+
+// load network (without flow) from binary snapshot at path without parsing text
+inline AdjacencyListFlowNetwork loadFlowNetworkSnapshot(const std::string& path) {
+    return AdjacencyListFlowNetwork(SnapshotFile(path, SnapshotType::FlowNetwork).toEdgeList());
+}
+
+#endif //WEIGHTED_GRAPHS_CPP_FLOWNETWORKSNAPSHOT_H
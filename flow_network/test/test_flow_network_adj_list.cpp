@@ -1,5 +1,10 @@
 #include "IndexedPriorityQueue.h"
 #include "AdjacencyListFlowNetwork.h"
+#include "EdgeListLoader.h"
+#include "FlowNetworkSnapshot.h"
+#include "FlowNetworkReordering.h"
+#include "FordFulkerson.h"
+#include <cstdio>
 #include "gtest/gtest.h"
 
 TEST(flow_network, basic) { // NOLINT
@@ -27,3 +32,47 @@ TEST(flow_network, basic) { // NOLINT
 }
 
 
+
+TEST(flow_network, from_edge_list) { // NOLINT
+    const char* text = "3 2\n0 1 2.5\n1 2 1\n";
+    const AdjacencyListFlowNetwork fn(parseEdgeList(text, true));
+    EXPECT_EQ(fn.V(), 3);
+    EXPECT_EQ(fn.E(), 2);
+    EXPECT_EQ(fn.adj(1).size(), 2);
+    EXPECT_EQ(fn.adj(0)[0]->capacity(), 2.5);
+    EXPECT_THROW(AdjacencyListFlowNetwork(parseEdgeList("2 1 0 1 0", true)), std::invalid_argument);
+    EXPECT_THROW(AdjacencyListFlowNetwork(parseEdgeList("2 1 0 1", false)), std::invalid_argument); // no capacities
+}
+
+TEST(flow_network, snapshot) { // NOLINT
+    AdjacencyListFlowNetwork fn(4);
+    fn.addEdge(FlowEdge(0, 1, 2.5));
+    fn.addEdge(FlowEdge(1, 2, 1));
+    fn.addEdge(FlowEdge(2, 2, 3)); // self-loop
+    fn.addEdge(FlowEdge(2, 0, 4));
+    const std::string path = "test_flow_network_snapshot_tmp.bin";
+    writeSnapshot(fn, path);
+
+    const auto loaded = loadFlowNetworkSnapshot(path);
+    EXPECT_EQ(loaded.V(), 4);
+    EXPECT_EQ(loaded.E(), 4);
+    for (int v = 0; v < 4; ++v) {
+        ASSERT_EQ(loaded.adj(v).size(), fn.adj(v).size());
+    }
+    EXPECT_EQ(loaded.adj(0)[0]->capacity(), 2.5);
+    EXPECT_EQ(loaded.adj(0)[1]->from(), 2);
+    std::remove(path.c_str());
+}
+
+TEST(flow_network, relabel) { // NOLINT
+    AdjacencyListFlowNetwork fn(4);
+    fn.addEdge(FlowEdge(0, 1, 2));
+    fn.addEdge(FlowEdge(1, 3, 1));
+    fn.addEdge(FlowEdge(0, 2, 3));
+    fn.addEdge(FlowEdge(2, 3, 4));
+    const auto permutation = computeVertexOrder(fn, VertexOrder::Bfs);
+    const auto relabeled = relabel(fn, permutation);
+    EXPECT_EQ(relabeled.E(), 4);
+    EXPECT_DOUBLE_EQ(FordFulkerson(relabeled, permutation.toNew(0), permutation.toNew(3)).getValue(),
+                     FordFulkerson(fn, 0, 3).getValue());
+}
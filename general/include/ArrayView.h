@@ -0,0 +1,68 @@
+#ifndef GRAPHS_CPP_ARRAYVIEW_H
+#define GRAPHS_CPP_ARRAYVIEW_H
+
+#include <cstddef>
+#include <vector>
+
+// Non-owning, read-only view of a contiguous sequence of T (similar to a const std::span<T> from C++20)
+// It is only valid as long as the memory it points to is valid.
+template<typename T>
+class ArrayView {
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+    using iterator = const_iterator;
+
+    // create empty view
+    constexpr ArrayView() noexcept = default;
+
+    // create view of count elements starting at first
+    constexpr ArrayView(const T* first, const size_t count) noexcept : ptr(first), num(count) {}
+
+    // create view of all elements in vec (implicit to allow returning vectors wherever a view is expected)
+    ArrayView(const std::vector<T>& vec) noexcept : ptr(vec.data()), num(vec.size()) {} // NOLINT
+
+    [[nodiscard]] constexpr const T* begin() const noexcept {
+        return ptr;
+    }
+
+    [[nodiscard]] constexpr const T* end() const noexcept {
+        return ptr + num;
+    }
+
+    [[nodiscard]] constexpr const T* data() const noexcept {
+        return ptr;
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return num;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return num == 0;
+    }
+
+    // element at index idx (unchecked)
+    [[nodiscard]] constexpr const T& operator[](const size_t idx) const noexcept {
+        return ptr[idx];
+    }
+
+    [[nodiscard]] const T& front() const noexcept {
+        return ptr[0];
+    }
+
+    [[nodiscard]] const T& back() const noexcept {
+        return ptr[num-1];
+    }
+
+    // copy elements into a new vector
+    [[nodiscard]] std::vector<T> toVector() const {
+        return std::vector<T>(begin(), end());
+    }
+
+private:
+    const T* ptr = nullptr;
+    size_t num = 0;
+};
+
+#endif //GRAPHS_CPP_ARRAYVIEW_H
@@ -0,0 +1,23 @@
+#ifndef GRAPHS_CPP_BENCHMARKHELPERS_H
+#define GRAPHS_CPP_BENCHMARKHELPERS_H
+
+#include <chrono>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+// Helpers shared by the benchmark programs of the modules
+
+// time fn in milliseconds (best of numRuns runs)
+inline double timeMs(const std::function<void()>& fn, const int numRuns = 3) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < numRuns; ++i) {
+        const auto startTime = std::chrono::steady_clock::now();
+        fn();
+        const auto endTime = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(endTime - startTime).count());
+    }
+    return best;
+}
+
+#endif //GRAPHS_CPP_BENCHMARKHELPERS_H
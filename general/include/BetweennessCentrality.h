@@ -0,0 +1,210 @@
+#ifndef GRAPHS_CPP_BETWEENNESSCENTRALITY_H
+#define GRAPHS_CPP_BETWEENNESSCENTRALITY_H
+
+#include <vector>
+#include <limits>
+#include <random>
+#include <numeric>
+#include <stdexcept>
+#include "GraphConcept.h"
+#include "IndexedPriorityQueue.h"
+#include "Parallel.h"
+
+// Brandes' algorithm for betweenness centrality (https://en.wikipedia.org/wiki/Betweenness_centrality), i.e. for
+// every vertex v the sum over all pairs s != v != t of the fraction of shortest s-t paths which pass through v.
+// One single-source search per source counts the shortest paths to all vertices (sigma), after which the dependencies
+// (delta) are accumulated in reverse order of distance over the successors on shortest paths. Sources are split into
+// fixed blocks, every thread accumulates one block at a time into its own buffers, and the block sums are added up in
+// block order, so the result does not depend on the number of threads or on scheduling.
+// The graph types use these functions in GraphBetweenness.h, DigraphBetweenness.h and EdgeWeightedDigraphBetweenness.h.
+
+namespace internal {
+    // buffers of one thread for Brandes' algorithm with distances of type Dist
+    template<typename Dist>
+    struct BrandesBuffers {
+        static constexpr Dist unreached = std::numeric_limits<Dist>::has_infinity ?
+                                          std::numeric_limits<Dist>::infinity() : std::numeric_limits<Dist>::max();
+
+        explicit BrandesBuffers(const int V) : dist(V, unreached), sigma(V, 0.0), delta(V, 0.0), centrality(V, 0.0) {}
+
+        std::vector<Dist> dist; // distance from the current source
+        std::vector<double> sigma; // number of shortest paths from the current source
+        std::vector<double> delta; // dependency of the current source on each vertex
+        std::vector<int> order{}; // reached vertices in order of non-decreasing distance
+        std::vector<double> centrality; // sum of the dependencies of all sources of this thread
+    };
+
+    // accumulate the dependencies of source s in reverse order of distance and reset the buffers for the next source
+    // forEachSuccessor(v, fn) must call fn(w) for every edge v->w on a shortest path from s
+    template<typename Dist, typename ForEachSuccessor>
+    void accumulateDependencies(const int s, BrandesBuffers<Dist>& buffers, ForEachSuccessor&& forEachSuccessor) {
+        auto& sigma = buffers.sigma;
+        auto& delta = buffers.delta;
+        for (auto it = buffers.order.rbegin(); it != buffers.order.rend(); ++it) {
+            const int v = *it;
+            double dependency = 0.0;
+            forEachSuccessor(v, [&](const int w) { dependency += sigma[v] / sigma[w] * (1.0 + delta[w]); });
+            delta[v] = dependency;
+            if (v != s) buffers.centrality[v] += dependency;
+        }
+        for (const int v : buffers.order) {
+            buffers.dist[v] = BrandesBuffers<Dist>::unreached;
+            sigma[v] = 0.0;
+            delta[v] = 0.0;
+        }
+        buffers.order.clear();
+    }
+
+    // dependencies of source s in an unweighted graph or digraph (BFS)
+    template<typename G>
+    void brandesBfs(const G& g, const int s, BrandesBuffers<int>& buffers) {
+        auto& dist = buffers.dist;
+        auto& sigma = buffers.sigma;
+        dist[s] = 0;
+        sigma[s] = 1.0;
+        buffers.order.push_back(s);
+        for (size_t head = 0; head < buffers.order.size(); ++head) {
+            const int v = buffers.order[head];
+            for (const int w : uncheckedAdj(g, v)) {
+                if (dist[w] == BrandesBuffers<int>::unreached) {
+                    dist[w] = dist[v] + 1;
+                    buffers.order.push_back(w);
+                }
+                if (dist[w] == dist[v] + 1) sigma[w] += sigma[v];
+            }
+        }
+        accumulateDependencies(s, buffers, [&](const int v, auto&& fn) {
+            for (const int w : uncheckedAdj(g, v)) {
+                if (dist[w] == dist[v] + 1) fn(w);
+            }
+        });
+    }
+
+    // dependencies of source s in a digraph with positive edge weights (Dijkstra), reusing the empty queue pq
+    template<typename DG>
+    void brandesDijkstra(const DG& dg, const int s, BrandesBuffers<double>& buffers, IndexedMinPriorityQueue<double>& pq) {
+        auto& dist = buffers.dist;
+        auto& sigma = buffers.sigma;
+        dist[s] = 0.0;
+        sigma[s] = 1.0;
+        pq.insert(s, 0.0);
+        while (!pq.empty()) {
+            const int v = static_cast<int>(pq.removeFirst());
+            buffers.order.push_back(v); // settled
+            for (const auto& e : uncheckedAdj(dg, v)) {
+                if (!(e.weight() > 0.0)) throw std::invalid_argument("Betweenness requires positive edge weights");
+                const int w = e.to();
+                const double distance = dist[v] + e.weight();
+                if (distance < dist[w]) {
+                    dist[w] = distance;
+                    sigma[w] = sigma[v];
+                    if (pq.contains(w)) {
+                        pq.changeKey(w, distance);
+                    } else {
+                        pq.insert(w, distance);
+                    }
+                } else if (distance == dist[w]) {
+                    sigma[w] += sigma[v];
+                }
+            }
+        }
+        accumulateDependencies(s, buffers, [&](const int v, auto&& fn) {
+            for (const auto& e : uncheckedAdj(dg, v)) {
+                if (dist[v] + e.weight() == dist[e.to()]) fn(e.to());
+            }
+        });
+    }
+
+    // sources per block of betweennessFromSources
+    constexpr size_t brandesBlockSize = 64;
+
+    // number of threads betweennessFromSources uses for numSources sources (at most one per block)
+    inline unsigned brandesThreads(const size_t numSources, const unsigned numThreads) {
+        const size_t numBlocks = (numSources + brandesBlockSize - 1) / brandesBlockSize;
+        return static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(resolveNumThreads(numThreads), numBlocks)));
+    }
+
+    // sum of the dependencies of all sources on numThreads threads (0: default number of threads), where
+    // singleSource(s, buffers, threadId) accumulates the dependencies of source s into the buffers of a thread
+    // Thread t handles block first+t of each round of blocks, and the block sums are added in block order afterwards.
+    template<typename Dist, typename SingleSource>
+    std::vector<double> betweennessFromSources(const int V, const std::vector<int>& sources, const unsigned numThreads,
+                                               SingleSource&& singleSource) {
+        const unsigned threads = brandesThreads(sources.size(), numThreads);
+        const size_t numBlocks = (sources.size() + brandesBlockSize - 1) / brandesBlockSize;
+        std::vector<BrandesBuffers<Dist>> buffers{};
+        buffers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t) buffers.emplace_back(V);
+        std::vector<double> result(V, 0.0);
+        for (size_t first = 0; first < numBlocks; first += threads) {
+            const unsigned blocks = static_cast<unsigned>(std::min<size_t>(threads, numBlocks - first));
+            runOnThreads(blocks, [&](const unsigned threadId) {
+                const size_t begin = (first + threadId) * brandesBlockSize;
+                const size_t end = std::min(sources.size(), begin + brandesBlockSize);
+                for (size_t i = begin; i < end; ++i) singleSource(sources[i], buffers[threadId], threadId);
+            });
+            parallelFor(0, V, threads, [&](const size_t v, unsigned) {
+                for (unsigned t = 0; t < blocks; ++t) {
+                    result[v] += buffers[t].centrality[v];
+                    buffers[t].centrality[v] = 0.0;
+                }
+            }, 4096);
+        }
+        return result;
+    }
+
+    // number of samples which selects all vertices as sources
+    constexpr int allSources = std::numeric_limits<int>::max();
+
+    // numSamples distinct random vertices out of V (all vertices if numSamples >= V)
+    inline std::vector<int> sampleSources(const int V, const int numSamples, const uint32_t seed) {
+        if (numSamples <= 0) throw std::invalid_argument("Number of samples must be positive");
+        std::vector<int> vertices(V);
+        std::iota(vertices.begin(), vertices.end(), 0);
+        if (numSamples >= V) return vertices;
+        std::mt19937 gen(seed);
+        for (int i = 0; i < numSamples; ++i) { // partial Fisher-Yates shuffle
+            std::uniform_int_distribution<int> dist(i, V - 1);
+            std::swap(vertices[i], vertices[dist(gen)]);
+        }
+        vertices.resize(numSamples);
+        return vertices;
+    }
+
+    // betweenness of an unweighted graph or digraph from numSamples random sources (all if numSamples >= V),
+    // extrapolated to all sources
+    template<typename G>
+    std::vector<double> unweightedBetweenness(const G& g, const int numSamples, const uint32_t seed,
+                                              const unsigned numThreads) {
+        const auto sources = sampleSources(g.V(), numSamples, seed);
+        auto result = betweennessFromSources<int>(g.V(), sources, numThreads, [&](const int s, auto& buffers, unsigned) {
+            brandesBfs(g, s, buffers);
+        });
+        if (!sources.empty() && static_cast<int>(sources.size()) < g.V()) {
+            const double scale = static_cast<double>(g.V()) / static_cast<double>(sources.size());
+            for (auto& c : result) c *= scale;
+        }
+        return result;
+    }
+
+    // betweenness of a digraph with positive edge weights from numSamples random sources (all if numSamples >= V),
+    // extrapolated to all sources
+    template<typename DG>
+    std::vector<double> weightedBetweenness(const DG& dg, const int numSamples, const uint32_t seed,
+                                            const unsigned numThreads) {
+        const auto sources = sampleSources(dg.V(), numSamples, seed);
+        std::vector<IndexedMinPriorityQueue<double>> queues{};
+        for (unsigned t = 0; t < brandesThreads(sources.size(), numThreads); ++t) queues.emplace_back(dg.V());
+        auto result = betweennessFromSources<double>(dg.V(), sources, numThreads,
+                                                     [&](const int s, auto& buffers, const unsigned threadId) {
+            brandesDijkstra(dg, s, buffers, queues[threadId]);
+        });
+        if (!sources.empty() && static_cast<int>(sources.size()) < dg.V()) {
+            const double scale = static_cast<double>(dg.V()) / static_cast<double>(sources.size());
+            for (auto& c : result) c *= scale;
+        }
+        return result;
+    }
+}
+
+#endif //GRAPHS_CPP_BETWEENNESSCENTRALITY_H
@@ -0,0 +1,110 @@
+#ifndef GRAPHS_CPP_BIDIRECTIONALBFS_H
+#define GRAPHS_CPP_BIDIRECTIONALBFS_H
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+// Memory for bidirectional BFS which can be reused across queries
+// Vertices are stamped with the number of the query which last visited them, so a new query does not need to reset
+// any per-vertex arrays and only costs as much as the vertices it visits.
+class BidirectionalBfsWorkspace {
+public:
+    // prepare new query on a graph with V vertices
+    void reset(const int V) {
+        for (auto& side : sides) {
+            if (static_cast<size_t>(V) > side.stamp.size()) {
+                side.stamp.resize(V, 0);
+                side.distTo.resize(V, -1);
+                side.edgeTo.resize(V, -1);
+            }
+            side.queue.clear();
+        }
+        if (epoch == std::numeric_limits<uint32_t>::max()) {
+            for (auto& side : sides) std::fill(side.stamp.begin(), side.stamp.end(), 0);
+            epoch = 0;
+        }
+        ++epoch;
+    }
+
+    // search state of one direction (0: forward from source, 1: backward from target)
+    struct Side {
+        std::vector<uint32_t> stamp{}; // query which last visited a vertex
+        std::vector<int> distTo{}; // number of steps from the start of this side (valid if stamp matches)
+        std::vector<int> edgeTo{}; // vertex from which a vertex was visited first (valid if stamp matches)
+        std::vector<int> queue{}; // visited vertices in order of their visit
+    };
+
+    std::array<Side, 2> sides{};
+    uint32_t epoch = 0; // number of current query
+};
+
+namespace internal {
+    // Bidirectional BFS from s to t on a graph with V vertices
+    // forwardAdj(v) must return the vertices reachable from v with one edge, backwardAdj(v) the vertices from which v
+    // can be reached with one edge (the same for undirected graphs). Always expands the side with the smaller frontier
+    // by one whole level and stops after the first level in which the two searches meet.
+    // Returns a shortest path from s to t (including both) or an empty vector if there is none.
+    template<typename ForwardAdj, typename BackwardAdj>
+    std::vector<int> bidirectionalBfsPath(const int V, const int s, const int t, ForwardAdj&& forwardAdj,
+                                          BackwardAdj&& backwardAdj, BidirectionalBfsWorkspace& workspace) {
+        if (s < 0 || s >= V || t < 0 || t >= V) throw std::invalid_argument("Invalid vertex");
+        if (s == t) return {s};
+
+        workspace.reset(V);
+        const uint32_t epoch = workspace.epoch;
+        auto& sides = workspace.sides;
+        const auto visit = [epoch](BidirectionalBfsWorkspace::Side& side, const int v, const int dist, const int from) {
+            side.stamp[v] = epoch;
+            side.distTo[v] = dist;
+            side.edgeTo[v] = from;
+            side.queue.push_back(v);
+        };
+        visit(sides[0], s, 0, -1);
+        visit(sides[1], t, 0, -1);
+        std::array<size_t, 2> levelBegin{0, 0}; // start of current frontier in queue of each side
+
+        int bestLength = std::numeric_limits<int>::max();
+        int meeting = -1; // vertex where the shortest path found so far crosses from one search to the other
+        while (meeting == -1) {
+            const size_t forwardFrontier = sides[0].queue.size() - levelBegin[0];
+            const size_t backwardFrontier = sides[1].queue.size() - levelBegin[1];
+            if (forwardFrontier == 0 || backwardFrontier == 0) break; // one side is exhausted -> no path
+
+            const int dir = forwardFrontier <= backwardFrontier ? 0 : 1;
+            auto& side = sides[dir];
+            const auto& other = sides[1 - dir];
+            const size_t levelEnd = side.queue.size();
+            for (size_t i = levelBegin[dir]; i < levelEnd; ++i) {
+                const int v = side.queue[i];
+                const auto adjacent = dir == 0 ? forwardAdj(v) : backwardAdj(v);
+                for (const int w : adjacent) {
+                    if (side.stamp[w] == epoch) continue;
+                    visit(side, w, side.distTo[v] + 1, v);
+                    if (other.stamp[w] == epoch && side.distTo[w] + other.distTo[w] < bestLength) {
+                        // searches meet in w (keep going until the end of the level to find the shortest meeting)
+                        bestLength = side.distTo[w] + other.distTo[w];
+                        meeting = w;
+                    }
+                }
+            }
+            levelBegin[dir] = levelEnd;
+        }
+
+        if (meeting == -1) return {};
+        std::vector<int> path{};
+        path.reserve(bestLength + 1);
+        for (int v = meeting; v != -1; v = sides[0].edgeTo[v]) {
+            path.push_back(v); // meeting back to s
+        }
+        std::reverse(path.begin(), path.end());
+        for (int v = sides[1].edgeTo[meeting]; v != -1; v = sides[1].edgeTo[v]) {
+            path.push_back(v); // after meeting to t
+        }
+        return path;
+    }
+}
+
+#endif //GRAPHS_CPP_BIDIRECTIONALBFS_H
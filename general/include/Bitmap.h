@@ -0,0 +1,82 @@
+#ifndef GRAPHS_CPP_BITMAP_H
+#define GRAPHS_CPP_BITMAP_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Fixed-size set of bits (like std::vector<bool>, but with access to whole 64-bit words for fast scans)
+class Bitmap {
+public:
+    // create bitmap with numBits bits, all unset
+    explicit Bitmap(const size_t numBits) : words((numBits + 63) / 64, 0), num(numBits) {}
+
+    // set bit i
+    void set(const size_t i) {
+        words[i / 64] |= uint64_t{1} << (i % 64);
+    }
+
+    // unset bit i
+    void reset(const size_t i) {
+        words[i / 64] &= ~(uint64_t{1} << (i % 64));
+    }
+
+    // whether bit i is set
+    [[nodiscard]] bool test(const size_t i) const {
+        return (words[i / 64] >> (i % 64)) & 1u;
+    }
+
+    // unset all bits
+    void clear() {
+        std::fill(words.begin(), words.end(), 0);
+    }
+
+    // call fn(i) for all set bits i in ascending order
+    template<typename Fn>
+    void forEachSet(Fn&& fn) const {
+        for (size_t w = 0; w < words.size(); ++w) {
+            uint64_t word = words[w];
+            while (word != 0) {
+                const size_t bit = countTrailingZeros(word);
+                fn(w * 64 + bit);
+                word &= word - 1; // unset lowest set bit
+            }
+        }
+    }
+
+    // number of bits
+    [[nodiscard]] size_t size() const {
+        return num;
+    }
+
+    // underlying words (bit i is bit i%64 of word i/64)
+    [[nodiscard]] std::vector<uint64_t>& data() {
+        return words;
+    }
+
+    void swap(Bitmap& other) noexcept {
+        words.swap(other.words);
+        std::swap(num, other.num);
+    }
+
+    // index of the lowest set bit of word (word must not be 0)
+    [[nodiscard]] static size_t countTrailingZeros(const uint64_t word) {
+#ifdef _MSC_VER
+        unsigned long idx;
+        _BitScanForward64(&idx, word);
+        return idx;
+#else
+        return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+    }
+
+private:
+    std::vector<uint64_t> words;
+    size_t num;
+};
+
+#endif //GRAPHS_CPP_BITMAP_H
@@ -0,0 +1,120 @@
+#ifndef GRAPHS_CPP_COMPRESSEDSPARSEROWS_H
+#define GRAPHS_CPP_COMPRESSEDSPARSEROWS_H
+
+#include <vector>
+#include <istream>
+#include <stdexcept>
+#include "ArrayView.h"
+
+// Adjacency structure in compressed sparse row (CSR) format: all adjacencies are stored in one contiguous array,
+// and the adjacencies of row (vertex) v are targets[offsets[v]] to targets[offsets[v+1]-1]
+class CompressedSparseRows {
+public:
+    // create structure with no rows
+    CompressedSparseRows() = default;
+
+    // create structure directly from offsets (numRows+1 elements, ascending, starting at 0) and targets
+    CompressedSparseRows(std::vector<size_t>&& _offsets, std::vector<int>&& _targets) :
+            offsets(std::move(_offsets)), targets(std::move(_targets)) {
+        if (offsets.empty() || offsets.front() != 0 || offsets.back() != targets.size()) {
+            throw std::invalid_argument("Invalid CSR offsets");
+        }
+    }
+
+    // build from a list of (from, to) pairs stored consecutively in endpoints with counting sort
+    // the order of the edges within each row is kept; with bothDirections, to->from is added as well
+    static CompressedSparseRows fromEndpoints(const int numRows, const std::vector<int>& endpoints,
+                                              const bool bothDirections) {
+        std::vector<size_t> offsets(static_cast<size_t>(numRows) + 1, 0);
+        // (1) count entries per row (shifted by one so that the prefix sum gives the start of each row)
+        for (size_t i = 0; i + 1 < endpoints.size(); i += 2) {
+            ++offsets[endpoints[i] + 1];
+            if (bothDirections) ++offsets[endpoints[i + 1] + 1];
+        }
+        // (2) prefix sum
+        for (int v = 0; v < numRows; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        // (3) place targets
+        std::vector<int> targets(offsets.back());
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1); // next free position per row
+        for (size_t i = 0; i + 1 < endpoints.size(); i += 2) {
+            const int from = endpoints[i];
+            const int to = endpoints[i + 1];
+            targets[next[from]++] = to;
+            if (bothDirections) targets[next[to]++] = from;
+        }
+        return CompressedSparseRows(std::move(offsets), std::move(targets));
+    }
+
+    // build the transpose, i.e. row w contains v for every entry w in row v (rows in ascending order of v)
+    [[nodiscard]] CompressedSparseRows transpose() const {
+        const int n = numRows();
+        std::vector<size_t> tOffsets(static_cast<size_t>(n) + 1, 0);
+        for (const int w : targets) {
+            ++tOffsets[w + 1];
+        }
+        for (int v = 0; v < n; ++v) {
+            tOffsets[v + 1] += tOffsets[v];
+        }
+        std::vector<int> tTargets(targets.size());
+        std::vector<size_t> next(tOffsets.begin(), tOffsets.end() - 1);
+        for (int v = 0; v < n; ++v) {
+            for (size_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                tTargets[next[targets[i]]++] = v;
+            }
+        }
+        return CompressedSparseRows(std::move(tOffsets), std::move(tTargets));
+    }
+
+    // entries of row v (unchecked)
+    [[nodiscard]] ArrayView<int> row(const int v) const {
+        return {targets.data() + offsets[v], offsets[v + 1] - offsets[v]};
+    }
+
+    // number of rows
+    [[nodiscard]] int numRows() const {
+        return static_cast<int>(offsets.size()) - 1;
+    }
+
+    // total number of entries in all rows
+    [[nodiscard]] size_t numEntries() const {
+        return targets.size();
+    }
+
+    // raw offsets array (numRows+1 elements)
+    [[nodiscard]] const std::vector<size_t>& rowOffsets() const {
+        return offsets;
+    }
+
+    // raw targets array (numEntries elements)
+    [[nodiscard]] const std::vector<int>& entries() const {
+        return targets;
+    }
+
+private:
+    std::vector<size_t> offsets{0}; // start of each row in targets, plus the end of the last row
+    std::vector<int> targets{}; // entries of all rows
+};
+
+namespace internal {
+    // read the "V E v1 w1 v2 w2 ..." edge-list format of unweighted graphs and digraphs
+    // returns the endpoints of all edges consecutively and sets numV and numE
+    inline std::vector<int> readEdgeEndpoints(std::istream& is, int& numV, int& numE) {
+        if (!(is >> numV) || numV < 0) throw std::invalid_argument("Invalid format (V)");
+        if (!(is >> numE) || numE < 0) throw std::invalid_argument("Invalid format (E)");
+        std::vector<int> endpoints(2 * static_cast<size_t>(numE));
+        for (size_t i = 0; i < endpoints.size(); i += 2) {
+            int v, w;
+            if (!(is >> v >> w)) throw std::invalid_argument("Invalid format (edges)");
+            if (v < 0 || v >= numV || w < 0 || w >= numV) {
+                throw std::invalid_argument("Cannot create edge v-w");
+            }
+            endpoints[i] = v;
+            endpoints[i + 1] = w;
+        }
+        return endpoints;
+    }
+}
+
+#endif //GRAPHS_CPP_COMPRESSEDSPARSEROWS_H
@@ -0,0 +1,76 @@
+#ifndef GRAPHS_CPP_DIRECTEDDFS_H
+#define GRAPHS_CPP_DIRECTEDDFS_H
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cstdint>
+#include "GraphConcept.h"
+
+// Iterative three-color DFS over all vertices of a digraph, which finds a cycle and the reverse postorder (i.e. a
+// topological order if there is no cycle) in the same pass. Vertices are white (not visited), gray (on the DFS stack)
+// or black (finished), and an edge to a gray vertex closes a cycle. The DFS stack is an explicit vector of frames, so
+// deep digraphs cannot overflow the call stack, and the cycle is read off this stack.
+// Used by containsCycle and topologicalSort of unweighted and weighted digraphs.
+
+namespace internal {
+    struct DirectedDfsResult {
+        std::optional<std::vector<int>> cycle{}; // v, w, ..., v for the first edge v->w to a gray vertex w
+        std::vector<int> reversePostorder{}; // all vertices (only complete if there is no cycle)
+    };
+
+    // DFS from every white vertex in ascending order, where targetOf(entry) is the target of an adjacency entry
+    // (e.g. an int for unweighted digraphs, or DirectedEdge::to() for weighted ones)
+    template<typename DG, typename TargetOf>
+    DirectedDfsResult directedDfs(const DG& dg, TargetOf&& targetOf) {
+        enum Color : uint8_t { white, gray, black };
+        using Iterator = decltype(uncheckedAdj(dg, 0).begin());
+        struct Frame {
+            int v;
+            Iterator next; // next adjacency of v to look at
+            Iterator end;
+        };
+
+        const int V = dg.V();
+        DirectedDfsResult result{};
+        result.reversePostorder.reserve(V);
+        std::vector<Color> color(V, white);
+        std::vector<Frame> stack{};
+        const auto push = [&](const int v) {
+            color[v] = gray;
+            const auto adj = uncheckedAdj(dg, v);
+            stack.push_back({v, adj.begin(), adj.end()});
+        };
+        for (int s = 0; s < V; ++s) {
+            if (color[s] != white) continue;
+            push(s);
+            while (!stack.empty()) {
+                Frame& frame = stack.back();
+                if (frame.next == frame.end) {
+                    color[frame.v] = black;
+                    result.reversePostorder.push_back(frame.v);
+                    stack.pop_back();
+                    continue;
+                }
+                const int w = targetOf(*frame.next);
+                ++frame.next;
+                if (color[w] == white) {
+                    push(w); // frame is invalid now
+                } else if (color[w] == gray) {
+                    // the frames from w to the top of the stack are the path w->...->v
+                    const int v = frame.v;
+                    size_t i = stack.size() - 1;
+                    while (stack[i].v != w) --i;
+                    std::vector<int> cycle{v};
+                    for (; i < stack.size(); ++i) cycle.push_back(stack[i].v);
+                    result.cycle = std::move(cycle);
+                    return result;
+                }
+            }
+        }
+        std::reverse(result.reversePostorder.begin(), result.reversePostorder.end());
+        return result;
+    }
+}
+
+#endif //GRAPHS_CPP_DIRECTEDDFS_H
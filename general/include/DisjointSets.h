@@ -2,37 +2,52 @@
 #define WEIGHTED_GRAPHS_CPP_DISJOINTSETS_H
 
 #include <vector>
+#include <stdexcept>
 
 // Disjoint-sets data structure with path compression and union-by-rank
 class DisjointSets {
 public:
     // construct with elements 0 to numElements-1 all in disjoint sets
     explicit DisjointSets(int numElements) :
-            parent(numElements, -1), rank(numElements, 0) {
+            parent(numElements, -1), rank(numElements, 0), setSizes(numElements, 1), numDisjointSets(numElements) {
         for(int i=0; i<numElements; ++i) {
             parent[i] = i;
         }
     }
 
-    // connect p and q, or throw for invalid arguments
-    void setUnion(const int p, const int q) {
+    // add a new element in its own set and return it
+    int addElement() {
+        const int p = size();
+        parent.push_back(p);
+        rank.push_back(0);
+        setSizes.push_back(1);
+        ++numDisjointSets;
+        return p;
+    }
+
+    // connect p and q and return whether they were in different sets before, or throw for invalid arguments
+    bool setUnion(const int p, const int q) {
         checkIndex(p); checkIndex(q);
         const int rp = findRoot(p);
         const int rq = findRoot(q);
-        if (rp == rq) return;
+        if (rp == rq) return false;
 
         // union-by-rank
+        --numDisjointSets;
         if (rank[rp] > rank[rq]) {
             // rp has a higher upper bound on its height
             parent[rq] = rp;
+            setSizes[rp] += setSizes[rq];
         } else {
             // rq has higher or equal rank
             parent[rp] = rq;
+            setSizes[rq] += setSizes[rp];
             if (rank[rp] == rank[rq]) {
                 // ranks were equal
                 ++rank[rq];
             }
         }
+        return true;
     }
 
     // return whether p and q are in the same set, or throw for invalid arguments
@@ -48,9 +63,45 @@ public:
         return parent.size();
     }
 
+    // return number of disjoint sets
+    [[nodiscard]]
+    int numSets() const {
+        return numDisjointSets;
+    }
+
+    // return the representative element of the set of p, or throw for invalid arguments
+    [[nodiscard]]
+    int find(const int p) {
+        checkIndex(p);
+        return findRoot(p);
+    }
+
+    // return number of elements in the set of p, or throw for invalid arguments
+    [[nodiscard]]
+    int setSize(const int p) {
+        checkIndex(p);
+        return setSizes[findRoot(p)];
+    }
+
+    // like connected, but without path compression, so that concurrent calls (without unions) are safe
+    [[nodiscard]]
+    bool connectedWithoutCompression(const int p, const int q) const {
+        checkIndex(p); checkIndex(q);
+        return findRootWithoutCompression(p) == findRootWithoutCompression(q);
+    }
+
+    // like setSize, but without path compression, so that concurrent calls (without unions) are safe
+    [[nodiscard]]
+    int setSizeWithoutCompression(const int p) const {
+        checkIndex(p);
+        return setSizes[findRootWithoutCompression(p)];
+    }
+
 private:
     std::vector<int> parent; // parent of each element
     std::vector<int> rank; // upper bound on the number of edges until a leaf is reached
+    std::vector<int> setSizes; // number of elements in the set of each root (only valid for roots)
+    int numDisjointSets; // number of disjoint sets
 
     // find the root of p
     [[nodiscard]]
@@ -62,6 +113,13 @@ private:
         return parent[p];
     }
 
+    // find the root of p without changing the parents (O(log n) steps due to union-by-rank)
+    [[nodiscard]]
+    int findRootWithoutCompression(int p) const {
+        while (p != parent[p]) p = parent[p];
+        return p;
+    }
+
     // check index and throw if invalid
     void checkIndex(const int p) const {
         if(p < 0 || static_cast<size_t>(p) >= parent.size()) {
@@ -0,0 +1,136 @@
+#ifndef GRAPHS_CPP_DYNAMICTOPOLOGICALORDER_H
+#define GRAPHS_CPP_DYNAMICTOPOLOGICALORDER_H
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include "GraphConcept.h"
+#include "DirectedDfs.h"
+
+// Topological order of a DAG which is kept up to date while edges are added, with the algorithm by Pearce and Kelly
+// (https://doi.org/10.1145/1187436.1210590). Inserting x->y with y already behind x changes nothing. Otherwise only
+// the affected region between the positions of y and x is searched: forward from y (vertices which have to move
+// behind x) and backward from x (vertices which have to move before y). Both sets are put back into the positions
+// they occupied, backward set first, so the cost depends on the size of the affected region and not on V. Reaching x
+// in the forward search means that x->y would close a cycle, and the edge is rejected without changes.
+// The graph types use this in IncrementalTopologicalOrderDigraph and IncrementalTopologicalOrderEdgeWeightedDigraph.
+
+namespace internal {
+    class DynamicTopologicalOrder {
+    public:
+        // order of V vertices without edges
+        explicit DynamicTopologicalOrder(const int V = 0) : position(V), vertexAt(V), predecessors(V), stamp(V, 0) {
+            std::iota(position.begin(), position.end(), 0);
+            std::iota(vertexAt.begin(), vertexAt.end(), 0);
+        }
+
+        // order of the vertices and edges of dg, where targetOf(entry) is the target of an adjacency entry
+        // dg must be acyclic!
+        template<typename DG, typename TargetOf>
+        DynamicTopologicalOrder(const DG& dg, TargetOf&& targetOf) : DynamicTopologicalOrder(dg.V()) {
+            auto dfs = directedDfs(dg, targetOf);
+            if (dfs.cycle) throw std::invalid_argument("Digraph must be acyclic");
+            vertexAt = std::move(dfs.reversePostorder);
+            for (int i = 0; i < dg.V(); ++i) position[vertexAt[i]] = i;
+            for (int v = 0; v < dg.V(); ++v) {
+                for (const auto& entry : uncheckedAdj(dg, v)) predecessors[targetOf(entry)].push_back(v);
+            }
+        }
+
+        // try to insert edge x->y into the order of dg (which does not contain x->y yet), where targetOf(entry) is
+        // the target of an adjacency entry of dg; returns false without changes if x->y would close a cycle
+        template<typename DG, typename TargetOf>
+        bool insert(const DG& dg, const int x, const int y, TargetOf&& targetOf) {
+            const int lowerBound = position[y];
+            const int upperBound = position[x];
+            if (lowerBound > upperBound) {
+                predecessors[y].push_back(x);
+                return true;
+            }
+            if (x == y) return false;
+
+            nextEpoch();
+            // (1) forward from y: vertices up to position upperBound which y reaches
+            forward.clear();
+            stack.assign(1, y);
+            stamp[y] = epoch;
+            while (!stack.empty()) {
+                const int v = stack.back();
+                stack.pop_back();
+                forward.push_back(v);
+                for (const auto& entry : uncheckedAdj(dg, v)) {
+                    const int w = targetOf(entry);
+                    if (w == x) return false; // y reaches x
+                    if (stamp[w] != epoch && position[w] < upperBound) {
+                        stamp[w] = epoch;
+                        stack.push_back(w);
+                    }
+                }
+            }
+            // (2) backward from x: vertices from position lowerBound on which reach x
+            backward.clear();
+            stack.assign(1, x);
+            stamp[x] = epoch;
+            while (!stack.empty()) {
+                const int v = stack.back();
+                stack.pop_back();
+                backward.push_back(v);
+                for (const int u : predecessors[v]) {
+                    if (stamp[u] != epoch && position[u] > lowerBound) {
+                        stamp[u] = epoch;
+                        stack.push_back(u);
+                    }
+                }
+            }
+            // (3) backward set before forward set, both in their previous relative order, in the freed positions
+            const auto byPosition = [&](const int a, const int b) { return position[a] < position[b]; };
+            std::sort(forward.begin(), forward.end(), byPosition);
+            std::sort(backward.begin(), backward.end(), byPosition);
+            freed.clear();
+            for (const int v : backward) freed.push_back(position[v]);
+            for (const int v : forward) freed.push_back(position[v]);
+            std::sort(freed.begin(), freed.end());
+            size_t i = 0;
+            for (const int v : backward) place(v, freed[i++]);
+            for (const int v : forward) place(v, freed[i++]);
+            predecessors[y].push_back(x);
+            return true;
+        }
+
+        // position of v in the order
+        [[nodiscard]] int positionOf(const int v) const {
+            return position[v];
+        }
+
+        // all vertices in topological order
+        [[nodiscard]] const std::vector<int>& order() const {
+            return vertexAt;
+        }
+
+    private:
+        std::vector<int> position; // position of each vertex in the order
+        std::vector<int> vertexAt; // vertex at each position
+        std::vector<std::vector<int>> predecessors; // in-edges for the backward search
+        std::vector<uint32_t> stamp; // epoch of the insertion which last visited each vertex
+        uint32_t epoch = 0;
+        std::vector<int> stack{}, forward{}, backward{}, freed{}; // reused buffers
+
+        void nextEpoch() {
+            if (epoch == std::numeric_limits<uint32_t>::max()) {
+                std::fill(stamp.begin(), stamp.end(), 0);
+                epoch = 0;
+            }
+            ++epoch;
+        }
+
+        void place(const int v, const int pos) {
+            position[v] = pos;
+            vertexAt[pos] = v;
+        }
+    };
+}
+
+#endif //GRAPHS_CPP_DYNAMICTOPOLOGICALORDER_H
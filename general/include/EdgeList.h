@@ -0,0 +1,18 @@
+#ifndef GRAPHS_CPP_EDGELIST_H
+#define GRAPHS_CPP_EDGELIST_H
+
+#include <vector>
+
+// Edges in the "V E v1 w1 [weight1] v2 w2 [weight2] ..." format of all graph types together with the degrees of all
+// vertices, so that graphs can reserve exactly the memory they need before adding the edges (see EdgeListLoader.h)
+struct EdgeList {
+    int numV = 0; // number of vertices
+    int numE = 0; // number of edges
+    bool hasWeights = false; // whether every edge has a weight (or capacity)
+    std::vector<int> endpoints{}; // from and to of edge i at 2*i and 2*i+1
+    std::vector<double> weights{}; // weight (or capacity) of edge i (empty if !hasWeights)
+    std::vector<int> outDegree{}; // number of edges starting at each vertex
+    std::vector<int> inDegree{}; // number of edges ending at each vertex
+};
+
+#endif //GRAPHS_CPP_EDGELIST_H
@@ -0,0 +1,137 @@
+#ifndef GRAPHS_CPP_EDGELISTLOADER_H
+#define GRAPHS_CPP_EDGELISTLOADER_H
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <cmath>
+#include <atomic>
+#include <stdexcept>
+#include "EdgeList.h"
+#include "MappedFile.h"
+#include "Parallel.h"
+
+namespace internal {
+    [[nodiscard]] inline bool isSpace(const char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    // parse the next whitespace-separated token in [pos, end) as T with std::from_chars and advance pos behind it
+    // returns false at the end of the input
+    template<typename T>
+    bool parseToken(const char*& pos, const char* end, T& value) {
+        while (pos != end && isSpace(*pos)) ++pos;
+        if (pos == end) return false;
+        const char* tokenEnd = pos;
+        while (tokenEnd != end && !isSpace(*tokenEnd)) ++tokenEnd;
+        if (*pos == '+') ++pos; // accepted by operator>> but not std::from_chars
+        const auto [ptr, ec] = std::from_chars(pos, tokenEnd, value);
+        if (ec != std::errc() || ptr != tokenEnd) throw std::invalid_argument("Invalid format (edges)");
+        pos = tokenEnd;
+        return true;
+    }
+
+    // number of whitespace-separated tokens which start in [begin, end)
+    inline size_t countTokens(const char* begin, const char* end, const bool previousIsSpace) {
+        size_t num = 0;
+        bool inSpace = previousIsSpace;
+        for (const char* p = begin; p != end; ++p) {
+            const bool space = isSpace(*p);
+            if (inSpace && !space) ++num;
+            inSpace = space;
+        }
+        return num;
+    }
+}
+
+// parse text in edge-list format on numThreads threads (0: default number of threads)
+// The text after the header is split into one chunk per thread at whitespace. Every thread counts the tokens of its
+// chunk, and after a prefix sum over the counts it knows which edges its tokens belong to and parses them with
+// std::from_chars directly into place. Additional tokens after the last edge are ignored.
+inline EdgeList parseEdgeList(const std::string_view text, const bool weighted, const unsigned numThreads = 0) {
+    EdgeList result{};
+    result.hasWeights = weighted;
+    const char* pos = text.data();
+    const char* const end = text.data() + text.size();
+    const auto parseHeaderValue = [&](int& value) {
+        try {
+            return internal::parseToken(pos, end, value) && value >= 0;
+        } catch (const std::invalid_argument&) {
+            return false;
+        }
+    };
+    if (!parseHeaderValue(result.numV)) throw std::invalid_argument("Invalid format (V)");
+    if (!parseHeaderValue(result.numE)) throw std::invalid_argument("Invalid format (E)");
+
+    const size_t tokensPerEdge = weighted ? 3 : 2;
+    const size_t numTokens = tokensPerEdge * static_cast<size_t>(result.numE);
+
+    // split the rest of the text into chunks which do not start in the middle of a token
+    const auto bodySize = static_cast<size_t>(end - pos);
+    const auto threads = static_cast<unsigned>(std::min<size_t>(resolveNumThreads(numThreads), bodySize / 65536 + 1));
+    std::vector<const char*> chunkBegin(threads + 1, end);
+    chunkBegin[0] = pos;
+    for (unsigned t = 1; t < threads; ++t) {
+        const char* p = std::max(chunkBegin[t - 1], pos + bodySize * t / threads);
+        while (p != end && !internal::isSpace(*p)) ++p; // move to the end of the token
+        chunkBegin[t] = p;
+    }
+
+    // (1) count tokens per chunk
+    std::vector<size_t> firstToken(threads + 1, 0); // index of first token of each chunk
+    runOnThreads(threads, [&](const unsigned t) {
+        const bool previousIsSpace = chunkBegin[t] == text.data() || internal::isSpace(*(chunkBegin[t] - 1));
+        firstToken[t + 1] = internal::countTokens(chunkBegin[t], chunkBegin[t + 1], previousIsSpace);
+    });
+    for (unsigned t = 0; t < threads; ++t) {
+        firstToken[t + 1] += firstToken[t];
+    }
+    if (firstToken[threads] < numTokens) throw std::invalid_argument("Invalid format (edges)");
+    // allocate only after counting, so that a header with too large E fails without allocating for E edges
+    result.endpoints.resize(2 * static_cast<size_t>(result.numE));
+    if (weighted) result.weights.resize(result.numE);
+
+    // (2) parse tokens of each chunk into place
+    runOnThreads(threads, [&](const unsigned t) {
+        const char* p = chunkBegin[t];
+        for (size_t token = firstToken[t]; token < std::min(firstToken[t + 1], numTokens); ++token) {
+            const size_t edge = token / tokensPerEdge;
+            const size_t field = token % tokensPerEdge;
+            if (field < 2) {
+                int v = -1;
+                internal::parseToken(p, chunkBegin[t + 1], v);
+                if (v < 0 || v >= result.numV) throw std::invalid_argument("Cannot create edge v-w");
+                result.endpoints[2 * edge + field] = v;
+            } else {
+                double weight = 0.0;
+                internal::parseToken(p, chunkBegin[t + 1], weight);
+                if (!std::isfinite(weight)) throw std::invalid_argument("Cannot create weighted edge v-w");
+                result.weights[edge] = weight;
+            }
+        }
+    });
+
+    // (3) count degrees
+    std::vector<std::atomic<int>> outDegree(result.numV), inDegree(result.numV);
+    parallelFor(0, result.numE, threads, [&](const size_t edge, unsigned) {
+        outDegree[result.endpoints[2 * edge]].fetch_add(1, std::memory_order_relaxed);
+        inDegree[result.endpoints[2 * edge + 1]].fetch_add(1, std::memory_order_relaxed);
+    }, 4096);
+    result.outDegree.resize(result.numV);
+    result.inDegree.resize(result.numV);
+    for (int v = 0; v < result.numV; ++v) {
+        result.outDegree[v] = outDegree[v].load(std::memory_order_relaxed);
+        result.inDegree[v] = inDegree[v].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+// memory-map the edge-list file at path and parse it on numThreads threads (0: default number of threads)
+// weighted: whether each edge has a weight (or capacity) after its two vertices
+inline EdgeList loadEdgeList(const std::string& path, const bool weighted, const unsigned numThreads = 0) {
+    const MappedFile file(path);
+    return parseEdgeList(file.view(), weighted, numThreads);
+}
+
+#endif //GRAPHS_CPP_EDGELISTLOADER_H
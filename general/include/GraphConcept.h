@@ -0,0 +1,42 @@
+#ifndef GRAPHS_CPP_GRAPHCONCEPT_H
+#define GRAPHS_CPP_GRAPHCONCEPT_H
+
+#include <type_traits>
+#include <utility>
+
+// Requirements of the algorithm templates on a graph type G (a C++17 substitute for a C++20 concept):
+//   g.V()              number of vertices
+//   g.adjUnchecked(v)  range of the adjacent vertices (or outgoing edges) of v, without bounds check, or else
+//   g.adj(v)           the same with bounds check (e.g. the virtual functions of the graph interfaces)
+// Concrete graph classes provide a non-virtual adjUnchecked, so that templates instantiated for them can inline the
+// iteration over adjacent vertices. Templates instantiated for the interfaces (graph::Graph, digraph::Digraph, ...)
+// use the virtual adj(v) and behave like the original functions.
+
+template<typename G, typename = void>
+struct HasUncheckedAdjacency : std::false_type {};
+
+template<typename G>
+struct HasUncheckedAdjacency<G, std::void_t<decltype(std::declval<const G&>().adjUnchecked(0))>> : std::true_type {};
+
+template<typename G, typename = void>
+struct IsGraphLike : std::false_type {};
+
+template<typename G>
+struct IsGraphLike<G, std::void_t<decltype(std::declval<const G&>().V()),
+                                  decltype(std::declval<const G&>().adj(0))>> : std::true_type {};
+
+// only enable a template for graph types, e.g. template<typename G, EnableIfGraphLike<G> = 0>
+template<typename G>
+using EnableIfGraphLike = std::enable_if_t<IsGraphLike<G>::value, int>;
+
+// adjacent vertices (or outgoing edges) of v, without bounds check where G supports it
+template<typename G>
+decltype(auto) uncheckedAdj(const G& g, const int v) {
+    if constexpr (HasUncheckedAdjacency<G>::value) {
+        return g.adjUnchecked(v);
+    } else {
+        return g.adj(v);
+    }
+}
+
+#endif //GRAPHS_CPP_GRAPHCONCEPT_H
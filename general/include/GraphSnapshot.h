@@ -0,0 +1,251 @@
+#ifndef GRAPHS_CPP_GRAPHSNAPSHOT_H
+#define GRAPHS_CPP_GRAPHSNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <stdexcept>
+#include "ArrayView.h"
+#include "EdgeList.h"
+#include "MappedFile.h"
+
+// Binary graph snapshots which can be memory-mapped and used without parsing or copying
+//
+// File layout (native byte order, every section starts at a multiple of 8 bytes):
+//   SnapshotHeader
+//   offsets: numV+1 uint64_t, the entries of vertex v are entries[offsets[v]] to entries[offsets[v+1]-1]
+//   entries: numEntries entries of entrySize bytes
+//     - Graph, Digraph: int32_t adjacent vertex (undirected edges are saved in the rows of both vertices)
+//     - EdgeWeightedGraph: SnapshotEdgeEntry (int32_t v, int32_t w, double weight), saved in the rows of v and w
+//     - EdgeWeightedDigraph, FlowNetwork: SnapshotEdgeEntry (int32_t from, int32_t to, double weight/capacity)
+//       saved in the row of from
+
+// type of graph saved in a snapshot
+enum class SnapshotType : uint32_t {
+    Graph = 1,
+    Digraph = 2,
+    EdgeWeightedGraph = 3,
+    EdgeWeightedDigraph = 4,
+    FlowNetwork = 5
+};
+
+// entry of weighted graphs, digraphs and flow networks (same layout as Edge and DirectedEdge)
+struct SnapshotEdgeEntry {
+    int32_t v;
+    int32_t w;
+    double weight;
+};
+static_assert(sizeof(SnapshotEdgeEntry) == 16, "Unexpected padding in SnapshotEdgeEntry");
+
+// first bytes of a snapshot file
+struct SnapshotHeader {
+    static constexpr char expectedMagic[8] = {'G', 'R', 'P', 'H', 'S', 'N', 'A', 'P'};
+    static constexpr uint32_t currentVersion = 1;
+    static constexpr uint32_t byteOrderMark = 0x01020304;
+
+    char magic[8]; // always expectedMagic
+    uint32_t version; // format version
+    uint32_t byteOrder; // byteOrderMark as written by the creating machine
+    uint32_t type; // SnapshotType
+    uint32_t entrySize; // bytes per entry
+    uint64_t numV; // number of vertices
+    uint64_t numE; // number of edges
+    uint64_t numEntries; // number of entries in all rows
+    uint64_t offsetsPos; // position of offsets in file
+    uint64_t entriesPos; // position of entries in file
+};
+static_assert(sizeof(SnapshotHeader) == 64, "Unexpected padding in SnapshotHeader");
+
+// size of entries of each snapshot type
+inline uint32_t snapshotEntrySize(const SnapshotType type) {
+    return type == SnapshotType::Graph || type == SnapshotType::Digraph ? sizeof(int32_t) : sizeof(SnapshotEdgeEntry);
+}
+
+// write snapshot of a graph with V vertices and E edges to path in two passes over its rows
+// rowSize(v) must return the number of entries of vertex v,
+// forEachEntry(v, write) must call write(entry) for all entries of v, with entries of type int32_t or SnapshotEdgeEntry
+template<typename RowSize, typename ForEachEntry>
+void writeSnapshotFile(const std::string& path, const SnapshotType type, const int V, const int E,
+                       RowSize&& rowSize, ForEachEntry&& forEachEntry) {
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    if (!ofs) throw std::runtime_error("Cannot open file " + path);
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SnapshotHeader::expectedMagic, sizeof(header.magic));
+    header.version = SnapshotHeader::currentVersion;
+    header.byteOrder = SnapshotHeader::byteOrderMark;
+    header.type = static_cast<uint32_t>(type);
+    header.entrySize = snapshotEntrySize(type);
+    header.numV = static_cast<uint64_t>(V);
+    header.numE = static_cast<uint64_t>(E);
+    header.offsetsPos = sizeof(SnapshotHeader);
+    header.entriesPos = header.offsetsPos + (header.numV + 1) * sizeof(uint64_t);
+
+    // (1) offsets
+    std::vector<uint64_t> offsets(header.numV + 1, 0);
+    for (int v = 0; v < V; ++v) {
+        offsets[v + 1] = offsets[v] + static_cast<uint64_t>(rowSize(v));
+    }
+    header.numEntries = offsets.back();
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+
+    // (2) entries
+    uint64_t written = 0;
+    for (int v = 0; v < V; ++v) {
+        forEachEntry(v, [&](const auto& entry) {
+            static_assert(std::is_same_v<std::decay_t<decltype(entry)>, int32_t> ||
+                          std::is_same_v<std::decay_t<decltype(entry)>, SnapshotEdgeEntry>, "Invalid entry type");
+            if (sizeof(entry) != header.entrySize) throw std::invalid_argument("Wrong entry type for snapshot type");
+            ofs.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+            ++written;
+        });
+        if (written != offsets[v + 1]) throw std::logic_error("Number of entries does not match row size");
+    }
+    // pad to a multiple of 8 bytes
+    const uint64_t padding = (8 - (header.numEntries * header.entrySize) % 8) % 8;
+    const char zeros[8] = {};
+    ofs.write(zeros, static_cast<std::streamsize>(padding));
+    if (!ofs) throw std::runtime_error("Cannot write file " + path);
+}
+
+// Memory-mapped snapshot file with validated header
+// Copies share the mapping; views into it stay valid as long as any copy exists.
+class SnapshotFile {
+public:
+    // map snapshot at path and check that it has the expected type
+    SnapshotFile(const std::string& path, const SnapshotType expectedType) : file(std::make_shared<MappedFile>(path)) {
+        if (file->size() < sizeof(SnapshotHeader)) throw std::runtime_error("Snapshot file too small");
+        std::memcpy(&header, file->data(), sizeof(SnapshotHeader));
+        if (std::memcmp(header.magic, SnapshotHeader::expectedMagic, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Not a graph snapshot");
+        }
+        if (header.version != SnapshotHeader::currentVersion) throw std::runtime_error("Unsupported snapshot version");
+        if (header.byteOrder != SnapshotHeader::byteOrderMark) throw std::runtime_error("Snapshot has wrong byte order");
+        if (header.type != static_cast<uint32_t>(expectedType)) throw std::runtime_error("Snapshot has wrong graph type");
+        if (header.entrySize != snapshotEntrySize(expectedType)) throw std::runtime_error("Snapshot has wrong entry size");
+        if (header.numV > static_cast<uint64_t>(std::numeric_limits<int>::max()) ||
+            header.numE > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("Snapshot is too large");
+        }
+        // sections in order offsets, entries within the file (checked without sums or products which could overflow)
+        const uint64_t fileSize = file->size();
+        if (header.offsetsPos % 8 != 0 || header.entriesPos % 8 != 0 ||
+            header.offsetsPos > header.entriesPos || header.entriesPos > fileSize ||
+            (header.entriesPos - header.offsetsPos) / sizeof(uint64_t) < header.numV + 1 ||
+            header.numEntries > (fileSize - header.entriesPos) / header.entrySize) {
+            throw std::runtime_error("Snapshot file is truncated or corrupt");
+        }
+        const auto offsets = rowOffsets();
+        if (offsets[0] != 0 || offsets[header.numV] != header.numEntries) {
+            throw std::runtime_error("Snapshot file is truncated or corrupt");
+        }
+        validateOffsets();
+    }
+
+    [[nodiscard]] int V() const {
+        return static_cast<int>(header.numV);
+    }
+
+    [[nodiscard]] int E() const {
+        return static_cast<int>(header.numE);
+    }
+
+    // numV+1 offsets of the rows in entries()
+    [[nodiscard]] ArrayView<uint64_t> rowOffsets() const {
+        return {reinterpret_cast<const uint64_t*>(file->data() + header.offsetsPos), header.numV + 1};
+    }
+
+    // all entries (Entry must be int32_t for Graph/Digraph and SnapshotEdgeEntry or a type with the same layout else)
+    template<typename Entry>
+    [[nodiscard]] ArrayView<Entry> entries() const {
+        if (sizeof(Entry) != header.entrySize) throw std::invalid_argument("Wrong entry type");
+        return {reinterpret_cast<const Entry*>(file->data() + header.entriesPos), header.numEntries};
+    }
+
+    // check that the offsets are ascending in O(V), so that every row lies within entries() (done when opening)
+    void validateOffsets() const {
+        const auto offsets = rowOffsets();
+        for (uint64_t v = 0; v < header.numV; ++v) {
+            if (offsets[v] > offsets[v + 1]) throw std::runtime_error("Snapshot has invalid offsets");
+        }
+    }
+
+    // check the offsets and that all entries refer to valid vertices in O(V+E)
+    // (entries are not checked when opening so that opening does not need to touch the adjacencies)
+    void validateRows() const {
+        validateOffsets();
+        const auto validVertex = [&](const int32_t w) {
+            return w >= 0 && static_cast<uint64_t>(w) < header.numV;
+        };
+        if (header.entrySize == sizeof(int32_t)) {
+            for (const int32_t w : entries<int32_t>()) {
+                if (!validVertex(w)) throw std::runtime_error("Snapshot has invalid vertex");
+            }
+        } else {
+            for (const auto& entry : entries<SnapshotEdgeEntry>()) {
+                if (!validVertex(entry.v) || !validVertex(entry.w)) throw std::runtime_error("Snapshot has invalid vertex");
+            }
+        }
+    }
+
+    // copy the edges into an edge list (e.g. to create a modifiable graph from the snapshot)
+    [[nodiscard]] EdgeList toEdgeList() const {
+        validateRows();
+        const auto type = static_cast<SnapshotType>(header.type);
+        const bool undirected = type == SnapshotType::Graph || type == SnapshotType::EdgeWeightedGraph;
+        const bool weighted = header.entrySize == sizeof(SnapshotEdgeEntry);
+
+        EdgeList result{};
+        result.numV = V();
+        result.numE = E();
+        result.hasWeights = weighted;
+        result.endpoints.reserve(2 * header.numE);
+        if (weighted) result.weights.reserve(header.numE);
+        result.outDegree.assign(header.numV, 0);
+        result.inDegree.assign(header.numV, 0);
+
+        const auto offsets = rowOffsets();
+        for (int v = 0; v < V(); ++v) {
+            bool selfLoopOpen = false; // undirected self-loops are saved twice in the row of their vertex
+            for (uint64_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                int from = v, to;
+                double weight = 0.0;
+                if (weighted) {
+                    const auto& entry = entries<SnapshotEdgeEntry>()[i];
+                    from = entry.v;
+                    to = entry.w;
+                    weight = entry.weight;
+                } else {
+                    to = entries<int32_t>()[i];
+                }
+                if (undirected) {
+                    // every edge is saved in the rows of both vertices, only take one copy
+                    if (weighted ? from != v : to < v) continue;
+                    if (to == v) {
+                        selfLoopOpen = !selfLoopOpen;
+                        if (!selfLoopOpen) continue;
+                    }
+                }
+                result.endpoints.push_back(from);
+                result.endpoints.push_back(to);
+                ++result.outDegree[from];
+                ++result.inDegree[to];
+                if (weighted) result.weights.push_back(weight);
+            }
+        }
+        if (result.endpoints.size() != 2 * header.numE) throw std::runtime_error("Snapshot has wrong number of edges");
+        return result;
+    }
+
+private:
+    std::shared_ptr<const MappedFile> file; // mapped file
+    SnapshotHeader header{}; // copy of the header
+};
+
+#endif //GRAPHS_CPP_GRAPHSNAPSHOT_H
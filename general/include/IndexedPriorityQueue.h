@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <optional>
+#include <stdexcept>
 
 template<typename Key, typename CompareShouldGoDown>
 class IndexedPriorityQueue {
@@ -0,0 +1,89 @@
+#ifndef GRAPHS_CPP_MAPPEDFILE_H
+#define GRAPHS_CPP_MAPPEDFILE_H
+
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#if defined(__unix__) || defined(__APPLE__)
+#define GRAPHS_CPP_HAS_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+// Read-only view of a whole file, memory-mapped where mmap is available (otherwise read into memory)
+// Mappings of the same file share the page cache between processes.
+class MappedFile {
+public:
+    // map file at path or throw std::runtime_error
+    explicit MappedFile(const std::string& path) {
+#ifdef GRAPHS_CPP_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("Cannot open file " + path);
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot read size of file " + path);
+        }
+        length = static_cast<size_t>(st.st_size);
+        if (length > 0) {
+            void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map file " + path);
+            }
+            ptr = static_cast<const char*>(mapped);
+        }
+        ::close(fd); // mapping stays valid after closing
+#else
+        std::ifstream ifs(path, std::ios::binary);
+        if (!ifs) throw std::runtime_error("Cannot open file " + path);
+        std::ostringstream oss;
+        oss << ifs.rdbuf();
+        buffer = oss.str();
+        ptr = buffer.data();
+        length = buffer.size();
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifdef GRAPHS_CPP_HAS_MMAP
+        if (ptr != nullptr) ::munmap(const_cast<char*>(ptr), length);
+#endif
+    }
+
+    // tell the OS that the file will be read sequentially (more read-ahead, earlier eviction)
+    void adviseSequential() const {
+#ifdef GRAPHS_CPP_HAS_MMAP
+        if (ptr != nullptr) ::madvise(const_cast<char*>(ptr), length, MADV_SEQUENTIAL);
+#endif
+    }
+
+    [[nodiscard]] const char* data() const {
+        return ptr;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return length;
+    }
+
+    [[nodiscard]] std::string_view view() const {
+        return {ptr, length};
+    }
+
+private:
+    const char* ptr = nullptr;
+    size_t length = 0;
+#ifndef GRAPHS_CPP_HAS_MMAP
+    std::string buffer{};
+#endif
+};
+
+#endif //GRAPHS_CPP_MAPPEDFILE_H
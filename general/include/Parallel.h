@@ -0,0 +1,122 @@
+#ifndef GRAPHS_CPP_PARALLEL_H
+#define GRAPHS_CPP_PARALLEL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <exception>
+
+// Helpers for running code on multiple threads with std::thread
+
+// number of threads to use when 0 is passed in as number of threads
+inline unsigned defaultNumThreads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// replace 0 with the default number of threads
+inline unsigned resolveNumThreads(const unsigned numThreads) {
+    return numThreads == 0 ? defaultNumThreads() : numThreads;
+}
+
+// Reusable barrier for a fixed number of threads (std::barrier is only available from C++20)
+class Barrier {
+public:
+    explicit Barrier(const unsigned numThreads) : threshold(numThreads), waiting(0), generation(0) {}
+
+    // block until all threads have called wait()
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        const unsigned gen = generation;
+        if (++waiting == threshold) {
+            // last thread -> release all others
+            waiting = 0;
+            ++generation;
+            cv.notify_all();
+        } else {
+            cv.wait(lock, [&] { return gen != generation; });
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    const unsigned threshold; // number of threads
+    unsigned waiting; // number of threads currently waiting
+    unsigned generation; // number of times all threads arrived
+};
+
+// run fn(threadId) on numThreads threads (IDs 0 to numThreads-1, ID 0 runs on the calling thread) and wait for all
+// The first exception thrown by fn is rethrown on the calling thread (fn must not throw while others wait at a Barrier)
+template<typename Fn>
+void runOnThreads(const unsigned numThreads, Fn&& fn) {
+    std::exception_ptr firstError{};
+    std::mutex errorMutex;
+    const auto guarded = [&](const unsigned threadId) {
+        try {
+            fn(threadId);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError) firstError = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(numThreads > 0 ? numThreads - 1 : 0);
+    for (unsigned t = 1; t < numThreads; ++t) {
+        threads.emplace_back(guarded, t);
+    }
+    guarded(0u);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+// Hands out chunks of the index range [0, end) to threads (dynamic scheduling)
+class ChunkedRange {
+public:
+    explicit ChunkedRange(const size_t _end = 0, const size_t _chunkSize = 256) :
+            next(0), end(_end), chunkSize(std::max<size_t>(1, _chunkSize)) {}
+
+    // get next chunk [begin, end) and return whether one was left
+    bool nextChunk(size_t& chunkBegin, size_t& chunkEnd) {
+        chunkBegin = next.fetch_add(chunkSize, std::memory_order_relaxed);
+        if (chunkBegin >= end) return false;
+        chunkEnd = std::min(end, chunkBegin + chunkSize);
+        return true;
+    }
+
+    // start handing out [0, newEnd) again (must not be called while threads are taking chunks)
+    void reset(const size_t newEnd) {
+        next.store(0, std::memory_order_relaxed);
+        end = newEnd;
+    }
+
+private:
+    std::atomic<size_t> next; // begin of next chunk
+    size_t end;
+    size_t chunkSize;
+};
+
+// call fn(i, threadId) for all i in [begin, end) on numThreads threads (0: default number of threads)
+template<typename Fn>
+void parallelFor(const size_t begin, const size_t end, const unsigned numThreads, Fn&& fn,
+                 const size_t chunkSize = 256) {
+    if (end <= begin) return;
+    ChunkedRange range(end - begin, chunkSize);
+    const unsigned threadsNeeded = static_cast<unsigned>(
+            std::min<size_t>(resolveNumThreads(numThreads), (end - begin + chunkSize - 1) / chunkSize));
+    runOnThreads(threadsNeeded, [&](const unsigned threadId) {
+        size_t chunkBegin, chunkEnd;
+        while (range.nextChunk(chunkBegin, chunkEnd)) {
+            for (size_t i = begin + chunkBegin; i < begin + chunkEnd; ++i) {
+                fn(i, threadId);
+            }
+        }
+    });
+}
+
+#endif //GRAPHS_CPP_PARALLEL_H
@@ -2,6 +2,7 @@
 #define WEIGHTED_GRAPHS_CPP_PRIORITYQUEUE_H
 
 #include <vector>
+#include <stdexcept>
 
 template<typename Key, typename CompareShouldGoDown>
 class PriorityQueue {
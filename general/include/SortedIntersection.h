@@ -0,0 +1,106 @@
+#ifndef GRAPHS_CPP_SORTEDINTERSECTION_H
+#define GRAPHS_CPP_SORTEDINTERSECTION_H
+
+#include <cstddef>
+#include <cstdint>
+#include "ArrayView.h"
+#include "Bitmap.h"
+#if defined(__AVX2__)
+#define GRAPHS_CPP_INTERSECTION_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GRAPHS_CPP_INTERSECTION_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Intersection of two sorted sets of ints (ascending, without duplicates), e.g. sorted adjacencies
+// Blocks of 4 (SSE2) or 8 (AVX2) elements of both sets are compared all-against-all with SIMD instructions, and the
+// block with the smaller maximum is skipped, as in a normal merge. The SIMD version is chosen at compile time
+// (compile with -mavx2 or -march=native for AVX2); the scalar merge is always available for comparison.
+
+namespace internal {
+    // call fn(x) for every x in both a[i..] and b[j..] with a scalar merge
+    template<typename Fn>
+    void forEachCommonScalarFrom(const ArrayView<int> a, size_t i, const ArrayView<int> b, size_t j, Fn&& fn) {
+        while (i < a.size() && j < b.size()) {
+            if (a[i] < b[j]) {
+                ++i;
+            } else if (b[j] < a[i]) {
+                ++j;
+            } else {
+                fn(a[i]);
+                ++i;
+                ++j;
+            }
+        }
+    }
+
+    // call fn(a[i + bit]) for every set bit of mask
+    template<typename Fn>
+    void forEachMaskedElement(const ArrayView<int> a, const size_t i, unsigned mask, Fn&& fn) {
+        while (mask != 0) {
+            fn(a[i + Bitmap::countTrailingZeros(mask)]);
+            mask &= mask - 1; // unset lowest set bit
+        }
+    }
+}
+
+// call fn(x) for every x in both a and b in ascending order (scalar merge)
+template<typename Fn>
+void forEachCommonScalar(const ArrayView<int> a, const ArrayView<int> b, Fn&& fn) {
+    internal::forEachCommonScalarFrom(a, 0, b, 0, fn);
+}
+
+// call fn(x) for every x in both a and b in ascending order (SIMD where available)
+template<typename Fn>
+void forEachCommon(const ArrayView<int> a, const ArrayView<int> b, Fn&& fn) {
+    size_t i = 0, j = 0;
+#if defined(GRAPHS_CPP_INTERSECTION_AVX2)
+    // compare the block of a with all 8 rotations of the block of b
+    const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while (i + 8 <= a.size() && j + 8 <= b.size()) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data() + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.data() + j));
+        __m256i equal = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; ++r) {
+            vb = _mm256_permutevar8x32_epi32(vb, rotate);
+            equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(va, vb));
+        }
+        internal::forEachMaskedElement(a, i, static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(equal))), fn);
+        const int aMax = a[i + 7], bMax = b[j + 7];
+        if (aMax <= bMax) i += 8;
+        if (bMax <= aMax) j += 8;
+    }
+#elif defined(GRAPHS_CPP_INTERSECTION_SSE2)
+    // compare the block of a with all 4 rotations of the block of b
+    while (i + 4 <= a.size() && j + 4 <= b.size()) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data() + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.data() + j));
+        const __m128i equal = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39))),
+                _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4E)),
+                             _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93))));
+        internal::forEachMaskedElement(a, i, static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal))), fn);
+        const int aMax = a[i + 3], bMax = b[j + 3];
+        if (aMax <= bMax) i += 4;
+        if (bMax <= aMax) j += 4;
+    }
+#endif
+    internal::forEachCommonScalarFrom(a, i, b, j, fn);
+}
+
+// number of elements in both a and b (scalar merge)
+inline size_t intersectionSizeScalar(const ArrayView<int> a, const ArrayView<int> b) {
+    size_t num = 0;
+    forEachCommonScalar(a, b, [&](int) { ++num; });
+    return num;
+}
+
+// number of elements in both a and b (SIMD where available)
+inline size_t intersectionSize(const ArrayView<int> a, const ArrayView<int> b) {
+    size_t num = 0;
+    forEachCommon(a, b, [&](int) { ++num; });
+    return num;
+}
+
+#endif //GRAPHS_CPP_SORTEDINTERSECTION_H
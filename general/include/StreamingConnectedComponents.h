@@ -0,0 +1,198 @@
+#ifndef GRAPHS_CPP_STREAMINGCONNECTEDCOMPONENTS_H
+#define GRAPHS_CPP_STREAMINGCONNECTEDCOMPONENTS_H
+
+#include <istream>
+#include <cstring>
+#include <cstdint>
+#include "DisjointSets.h"
+#include "EdgeListLoader.h"
+#include "GraphSnapshot.h"
+
+namespace internal {
+    // Reads whitespace-separated tokens from an input stream through a fixed-size buffer
+    // (for inputs which do not fit into memory; tokens may span buffer boundaries)
+    class StreamTokenReader {
+    public:
+        StreamTokenReader(std::istream& _is, const size_t bufferSize) : is(_is), buffer(std::max<size_t>(bufferSize, 64)) {}
+
+        // parse the next token as T and return true, or return false at the end of the input
+        template<typename T>
+        bool next(T& value) {
+            // skip whitespace, reading more of the input as necessary
+            while (true) {
+                while (pos != end && isSpace(buffer[pos])) ++pos;
+                if (pos != end) break;
+                pos = end = 0;
+                readMore();
+                if (end == 0) return false;
+            }
+            // find the end of the token; move an incomplete token to the front of the buffer and read the rest
+            size_t tokenEnd = pos;
+            while (true) {
+                while (tokenEnd != end && !isSpace(buffer[tokenEnd])) ++tokenEnd;
+                if (tokenEnd != end || eof) break;
+                const size_t length = tokenEnd - pos;
+                if (length == buffer.size()) throw std::invalid_argument("Invalid format (token too long)");
+                std::memmove(buffer.data(), buffer.data() + pos, length);
+                pos = 0;
+                end = tokenEnd = length;
+                readMore();
+            }
+            const char* p = buffer.data() + pos;
+            parseToken(p, buffer.data() + tokenEnd, value);
+            pos = tokenEnd;
+            return true;
+        }
+
+    private:
+        std::istream& is;
+        std::vector<char> buffer;
+        size_t pos = 0; // next unread character in buffer
+        size_t end = 0; // end of the valid characters in buffer
+        bool eof = false; // whether the whole input was read into the buffer
+
+        // append as much of the input to the buffer as fits
+        void readMore() {
+            if (eof) return;
+            is.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+            const auto numRead = static_cast<size_t>(is.gcount());
+            end += numRead;
+            if (numRead == 0 || !is) eof = true;
+        }
+    };
+}
+
+// Connected components of a graph whose edges are only seen once, one after the other (semi-streaming model)
+// Only a DisjointSets with O(V) memory is kept, so edge lists much larger than the main memory can be processed in a
+// single sequential pass. For digraphs, the weakly connected components are calculated.
+class StreamingConnectedComponents {
+public:
+    // components of V vertices without edges
+    explicit StreamingConnectedComponents(const int V) : sets(checkedNumVertices(V)) {}
+
+    // read a graph in edge-list format ("V E v1 w1 [weight1] ..."), e.g. from a std::ifstream, through a buffer of
+    // bufferSize bytes
+    // weighted: whether each edge has a weight (or capacity) after its two vertices (which is ignored)
+    static StreamingConnectedComponents fromStream(std::istream& is, const bool weighted,
+                                                   const size_t bufferSize = size_t{1} << 20) {
+        internal::StreamTokenReader reader(is, bufferSize);
+        return fromTokens(weighted, [&](auto& value) { return reader.next(value); });
+    }
+
+    // read an edge-list file sequentially from a memory mapping (pages are read ahead and evicted by the OS)
+    static StreamingConnectedComponents fromFile(const std::string& path, const bool weighted) {
+        const MappedFile file(path);
+        file.adviseSequential();
+        const char* pos = file.data();
+        const char* const end = file.data() + file.size();
+        return fromTokens(weighted, [&](auto& value) { return internal::parseToken(pos, end, value); });
+    }
+
+    // read the rows of a snapshot file (see GraphSnapshot.h) of the given type one after the other
+    static StreamingConnectedComponents fromSnapshot(const std::string& path, const SnapshotType type) {
+        const SnapshotFile snapshot(path, type);
+        StreamingConnectedComponents result(snapshot.V());
+        const auto offsets = snapshot.rowOffsets();
+        if (snapshotEntrySize(type) == sizeof(int32_t)) {
+            const auto targets = snapshot.entries<int32_t>();
+            for (int v = 0; v < snapshot.V(); ++v) {
+                for (uint64_t i = offsets[v]; i < offsets[v + 1]; ++i) result.addEdge(v, targets[i]);
+            }
+        } else {
+            for (const auto& entry : snapshot.entries<SnapshotEdgeEntry>()) result.addEdge(entry.v, entry.w);
+        }
+        return result;
+    }
+
+    // process edge v-w
+    void addEdge(const int v, const int w) {
+        if (!vertexValid(v) || !vertexValid(w)) throw std::invalid_argument("Cannot create edge v-w");
+        sets.setUnion(v, w);
+    }
+
+    // number of vertices
+    [[nodiscard]] int V() const {
+        return sets.size();
+    }
+
+    // number of connected components
+    [[nodiscard]] int count() const {
+        return sets.numSets();
+    }
+
+    // whether v and w are connected by the edges processed so far
+    [[nodiscard]] bool connected(const int v, const int w) {
+        if (!vertexValid(v) || !vertexValid(w)) throw std::invalid_argument("Invalid vertex");
+        return sets.connected(v, w);
+    }
+
+    // number of vertices in the component of v
+    [[nodiscard]] int componentSize(const int v) {
+        if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+        return sets.setSize(v);
+    }
+
+    // component ID of every vertex, numbered in the order of the smallest vertex of each component
+    // (i.e. like graph::ConnectedComponents)
+    [[nodiscard]] std::vector<int> componentIds() {
+        std::vector<int> idOfRoot(V(), -1);
+        std::vector<int> result(V());
+        int numIds = 0;
+        for (int v = 0; v < V(); ++v) {
+            int& id = idOfRoot[sets.find(v)];
+            if (id == -1) id = numIds++;
+            result[v] = id;
+        }
+        return result;
+    }
+
+    // number of vertices of each component, indexed by the IDs of componentIds()
+    [[nodiscard]] std::vector<int> componentSizes() {
+        std::vector<int> result(count(), 0);
+        for (const int id : componentIds()) ++result[id];
+        return result;
+    }
+
+private:
+    DisjointSets sets; // components of the edges processed so far
+
+    [[nodiscard]] bool vertexValid(const int v) const {
+        return v >= 0 && v < V();
+    }
+
+    // return V, or throw before the sets are created from an invalid V
+    static int checkedNumVertices(const int V) {
+        if (V < 0) throw std::invalid_argument("Invalid number of vertices");
+        return V;
+    }
+
+    // read header and edges with nextToken(value), which returns false at the end of the input
+    template<typename NextToken>
+    static StreamingConnectedComponents fromTokens(const bool weighted, NextToken&& nextToken) {
+        const auto parseHeaderValue = [&](auto& value) {
+            try {
+                return nextToken(value) && value >= 0;
+            } catch (const std::invalid_argument&) {
+                return false;
+            }
+        };
+        // only the vertices have to fit into int, the number of edges may not
+        int numV = 0;
+        int64_t numE = 0;
+        if (!parseHeaderValue(numV)) throw std::invalid_argument("Invalid format (V)");
+        if (!parseHeaderValue(numE)) throw std::invalid_argument("Invalid format (E)");
+        StreamingConnectedComponents result(numV);
+        for (int64_t i = 0; i < numE; ++i) {
+            int v = -1, w = -1;
+            if (!nextToken(v) || !nextToken(w)) throw std::invalid_argument("Invalid format (edges)");
+            if (weighted) {
+                double weight = 0.0;
+                if (!nextToken(weight)) throw std::invalid_argument("Invalid format (edges)");
+            }
+            result.addEdge(v, w);
+        }
+        return result;
+    }
+};
+
+#endif //GRAPHS_CPP_STREAMINGCONNECTEDCOMPONENTS_H
@@ -0,0 +1,111 @@
+#ifndef GRAPHS_CPP_TOPOLOGICALLEVELS_H
+#define GRAPHS_CPP_TOPOLOGICALLEVELS_H
+
+#include <vector>
+#include <atomic>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include "ArrayView.h"
+#include "GraphConcept.h"
+#include "DirectedDfs.h"
+#include "Parallel.h"
+
+// Topological sort of a DAG split into levels (wavefronts) with Kahn's algorithm
+// (https://en.wikipedia.org/wiki/Topological_sorting#Kahn's_algorithm)
+// Level 0 contains all vertices without in-edges, and level i+1 all vertices whose in-edges only come from levels
+// 0...i, i.e. the vertices of a level do not depend on each other (e.g. jobs which can run concurrently once the
+// previous levels are done). In-degrees are counted and each level is processed on multiple threads with atomic
+// in-degree decrements. The vertices of each level are sorted, so the result does not depend on the number of threads.
+// The graph types use this in DigraphTopologicalLevels.h and EdgeWeightedDigraphTopologicalLevels.h.
+class TopologicalLevels {
+public:
+    // levels of dg on numThreads threads (0: default number of threads), where targetOf(entry) is the target of an
+    // adjacency entry (e.g. an int for unweighted digraphs, or DirectedEdge::to() for weighted ones)
+    template<typename DG, typename TargetOf>
+    TopologicalLevels(const DG& dg, TargetOf&& targetOf, const unsigned numThreads) {
+        constexpr size_t chunk = 256;
+        const int V = dg.V();
+        const unsigned threads = resolveNumThreads(numThreads);
+        std::vector<std::atomic<int>> inDegree(V);
+        parallelFor(0, V, threads, [&](const size_t v, unsigned) {
+            inDegree[v].store(0, std::memory_order_relaxed);
+        }, chunk);
+        parallelFor(0, V, threads, [&](const size_t v, unsigned) {
+            for (const auto& entry : uncheckedAdj(dg, static_cast<int>(v))) {
+                inDegree[targetOf(entry)].fetch_add(1, std::memory_order_relaxed);
+            }
+        }, chunk);
+
+        // each thread collects vertices of the next level, which are appended to sortedOrder as a level
+        std::vector<std::vector<int>> local(threads);
+        const auto appendLevel = [&] {
+            const size_t levelBegin = sortedOrder.size();
+            for (auto& out : local) {
+                sortedOrder.insert(sortedOrder.end(), out.begin(), out.end());
+                out.clear();
+            }
+            std::sort(sortedOrder.begin() + static_cast<std::ptrdiff_t>(levelBegin), sortedOrder.end());
+            if (sortedOrder.size() > levelBegin) levelOffsets.push_back(sortedOrder.size());
+        };
+        sortedOrder.reserve(V);
+        levelOffsets.push_back(0);
+        parallelFor(0, V, threads, [&](const size_t v, const unsigned threadId) {
+            if (inDegree[v].load(std::memory_order_relaxed) == 0) local[threadId].push_back(static_cast<int>(v));
+        }, chunk);
+        appendLevel();
+        for (size_t level = 0; level + 1 < levelOffsets.size(); ++level) {
+            const auto decrementSuccessors = [&](const size_t i, const unsigned threadId) {
+                for (const auto& entry : uncheckedAdj(dg, sortedOrder[i])) {
+                    const int w = targetOf(entry);
+                    if (inDegree[w].fetch_sub(1, std::memory_order_relaxed) == 1) local[threadId].push_back(w);
+                }
+            };
+            parallelFor(levelOffsets[level], levelOffsets[level + 1], threads, decrementSuccessors, 64);
+            appendLevel();
+        }
+
+        // vertices which never lost all in-edges are on a cycle or behind one
+        if (static_cast<int>(sortedOrder.size()) < V) {
+            foundCycle = internal::directedDfs(dg, targetOf).cycle;
+        }
+    }
+
+    // whether all vertices were sorted, i.e. the digraph is acyclic
+    [[nodiscard]] bool acyclic() const {
+        return !foundCycle.has_value();
+    }
+
+    // a cycle v, w, ..., v if the digraph is not acyclic
+    [[nodiscard]] const std::optional<std::vector<int>>& cycle() const {
+        return foundCycle;
+    }
+
+    // all sorted vertices level by level (a topological order if the digraph is acyclic)
+    [[nodiscard]] const std::vector<int>& order() const {
+        return sortedOrder;
+    }
+
+    // number of levels
+    [[nodiscard]] int numLevels() const {
+        return static_cast<int>(levelOffsets.size()) - 1;
+    }
+
+    // vertices of level i in ascending order
+    [[nodiscard]] ArrayView<int> level(const int i) const {
+        if (i < 0 || i >= numLevels()) throw std::invalid_argument("Invalid level");
+        return {sortedOrder.data() + levelOffsets[i], levelOffsets[i + 1] - levelOffsets[i]};
+    }
+
+    // start of every level in order() followed by the end of the last level (numLevels()+1 values)
+    [[nodiscard]] const std::vector<size_t>& levelBoundaries() const {
+        return levelOffsets;
+    }
+
+private:
+    std::vector<int> sortedOrder{};
+    std::vector<size_t> levelOffsets{};
+    std::optional<std::vector<int>> foundCycle{};
+};
+
+#endif //GRAPHS_CPP_TOPOLOGICALLEVELS_H
@@ -0,0 +1,265 @@
+#ifndef GRAPHS_CPP_VARINTROWS_H
+#define GRAPHS_CPP_VARINTROWS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+
+// Adjacency rows with sorted targets, stored as gaps between consecutive targets in variable-length integers
+// (LEB128: 7 bits per byte, the highest bit marks that another byte follows)
+// Row v is stored as: number of targets, skip table (only for rows with more than blockSize targets), first target
+// relative to v (zigzag-encoded, as it may be smaller than v), gaps to the following targets. The skip table contains
+// one entry per further block of blockSize targets (position of its first gap, target before it), so that
+// contains(v, w) only decodes one block. Rows start at a 64-bit base offset per group of rowsPerBase rows plus a
+// 32-bit offset per row.
+// Small gaps need a single byte, so the rows become much smaller than plain int arrays if neighbors have close IDs,
+// e.g. after relabeling with a cache-friendly vertex order (see VertexReordering.h).
+class VarintRows {
+public:
+    static constexpr size_t blockSize = 64; // number of targets per skip block
+    static constexpr int rowsPerBase = 256; // number of rows per 64-bit base offset
+
+    // forward iterator which decodes the targets of a row one after the other
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = int;
+
+        Iterator() = default;
+
+        // iterator at target current, followed by remaining-1 gaps starting at pos
+        Iterator(const uint8_t* _pos, const size_t _remaining, const int current) :
+                pos(_pos), remaining(_remaining), value(current) {}
+
+        int operator*() const {
+            return value;
+        }
+
+        Iterator& operator++() {
+            if (--remaining > 0) value += static_cast<int>(decode(pos));
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& rhs) const {
+            return remaining == rhs.remaining;
+        }
+
+        bool operator!=(const Iterator& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        const uint8_t* pos = nullptr; // next gap to decode
+        size_t remaining = 0; // number of targets from the current one to the end of the row
+        int value = 0; // current target
+    };
+
+    // targets of one row in ascending order (decoded while iterating)
+    class Row {
+    public:
+        Row(const uint8_t* _first, const size_t _size, const int _v) : first(_first), numTargets(_size), v(_v) {}
+
+        [[nodiscard]] Iterator begin() const {
+            if (numTargets == 0) return {};
+            const uint8_t* pos = first;
+            const int firstTarget = v + unzigzag(decode(pos));
+            return {pos, numTargets, firstTarget};
+        }
+
+        [[nodiscard]] Iterator end() const {
+            return {};
+        }
+
+        [[nodiscard]] size_t size() const {
+            return numTargets;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return numTargets == 0;
+        }
+
+        // copy targets into a vector
+        [[nodiscard]] std::vector<int> toVector() const {
+            return {begin(), end()};
+        }
+
+    private:
+        const uint8_t* first; // encoded first target of the row
+        size_t numTargets; // number of targets
+        int v; // row index (the first target is stored relative to it)
+    };
+
+    // create structure with no rows
+    VarintRows() = default;
+
+    // build numRows rows, where rowOf(v) returns a range of the (not necessarily sorted) non-negative targets of row v
+    template<typename RowOf>
+    VarintRows(const int numRows, RowOf&& rowOf) : rowOffsets(numRows) {
+        baseOffsets.reserve(numRows / rowsPerBase + 1);
+        std::vector<int> sorted{};
+        for (int v = 0; v < numRows; ++v) {
+            if (v % rowsPerBase == 0) baseOffsets.push_back(bytes.size());
+            const uint64_t offset = bytes.size() - baseOffsets.back();
+            if (offset > std::numeric_limits<uint32_t>::max()) throw std::invalid_argument("Rows are too large");
+            rowOffsets[v] = static_cast<uint32_t>(offset);
+            const auto row = rowOf(v);
+            sorted.assign(row.begin(), row.end());
+            std::sort(sorted.begin(), sorted.end());
+            if (!sorted.empty() && sorted.front() < 0) throw std::invalid_argument("Targets must not be negative");
+            appendRow(v, sorted);
+            numTargets += sorted.size();
+        }
+        bytes.shrink_to_fit();
+    }
+
+    // targets of row v in ascending order (no bounds check)
+    [[nodiscard]] Row row(const int v) const {
+        const uint8_t* pos = rowStart(v);
+        const size_t size = decode(pos);
+        return {pos + numSkipEntries(size) * sizeof(SkipEntry), size, v};
+    }
+
+    // number of targets of row v (no bounds check)
+    [[nodiscard]] size_t rowSize(const int v) const {
+        const uint8_t* pos = rowStart(v);
+        return decode(pos);
+    }
+
+    // whether row v contains target w (no bounds check), decoding at most one block of the row
+    [[nodiscard]] bool contains(const int v, const int w) const {
+        const uint8_t* pos = rowStart(v);
+        const size_t size = decode(pos);
+        const size_t numSkips = numSkipEntries(size);
+        const uint8_t* const gaps = pos + numSkips * sizeof(SkipEntry);
+
+        // last block which can contain w: binary search for the last skip entry whose previous target is < w
+        size_t lo = 0, hi = numSkips; // blocks 1...lo are known to start before w
+        while (lo < hi) {
+            const size_t mid = (lo + hi + 1) / 2;
+            if (skipEntry(pos, mid - 1).previous < w) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        const size_t first = lo * blockSize;
+        const size_t last = std::min(size, first + blockSize);
+        if (first == last) return false;
+        const uint8_t* start = gaps;
+        int current;
+        if (lo == 0) {
+            current = v + unzigzag(decode(start));
+        } else {
+            const SkipEntry entry = skipEntry(pos, lo - 1);
+            start += entry.gapPos;
+            current = entry.previous + static_cast<int>(decode(start));
+        }
+        for (Iterator it(start, last - first, current), end{}; it != end; ++it) {
+            if (*it >= w) return *it == w;
+        }
+        return false;
+    }
+
+    // number of rows
+    [[nodiscard]] int numRows() const {
+        return static_cast<int>(rowOffsets.size());
+    }
+
+    // number of targets in all rows
+    [[nodiscard]] size_t numEntries() const {
+        return numTargets;
+    }
+
+    // bytes used by offsets and encoded rows
+    [[nodiscard]] size_t memoryBytes() const {
+        return baseOffsets.capacity() * sizeof(uint64_t) + rowOffsets.capacity() * sizeof(uint32_t) + bytes.capacity();
+    }
+
+private:
+    struct SkipEntry {
+        uint32_t gapPos; // position of the first gap of the block relative to the first gap of the row
+        int32_t previous; // target before the block
+    };
+
+    std::vector<uint64_t> baseOffsets{}; // start of each group of rowsPerBase rows in bytes
+    std::vector<uint32_t> rowOffsets{}; // start of each row in bytes relative to the start of its group
+    std::vector<uint8_t> bytes{}; // encoded rows
+    size_t numTargets = 0; // number of targets in all rows
+
+    [[nodiscard]] const uint8_t* rowStart(const int v) const {
+        return bytes.data() + baseOffsets[v / rowsPerBase] + rowOffsets[v];
+    }
+
+    [[nodiscard]] static size_t numSkipEntries(const size_t rowSize) {
+        return rowSize > blockSize ? (rowSize - 1) / blockSize : 0;
+    }
+
+    [[nodiscard]] static SkipEntry skipEntry(const uint8_t* table, const size_t i) {
+        SkipEntry entry{};
+        std::memcpy(&entry, table + i * sizeof(SkipEntry), sizeof(SkipEntry)); // unaligned
+        return entry;
+    }
+
+    // decode a variable-length integer at pos and advance pos behind it
+    static uint64_t decode(const uint8_t*& pos) {
+        uint64_t byte = *pos++;
+        if (byte < 0x80) return byte; // fast path for small gaps
+        uint64_t result = byte & 0x7F;
+        for (int shift = 7;; shift += 7) {
+            byte = *pos++;
+            result |= (byte & 0x7F) << shift;
+            if (byte < 0x80) return result;
+        }
+    }
+
+    // map signed to unsigned integers with small absolute values to small values (0, -1, 1, -2, ... to 0, 1, 2, 3, ...)
+    static uint64_t zigzag(const int64_t value) {
+        return value < 0 ? 2 * static_cast<uint64_t>(-(value + 1)) + 1 : 2 * static_cast<uint64_t>(value);
+    }
+
+    static int unzigzag(const uint64_t value) {
+        return (value & 1) != 0 ? -static_cast<int>(value >> 1) - 1 : static_cast<int>(value >> 1);
+    }
+
+    void encode(uint64_t value) {
+        while (value >= 0x80) {
+            bytes.push_back(static_cast<uint8_t>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<uint8_t>(value));
+    }
+
+    void appendRow(const int v, const std::vector<int>& sorted) {
+        encode(sorted.size());
+        const size_t numSkips = numSkipEntries(sorted.size());
+        const size_t tablePos = bytes.size();
+        bytes.resize(bytes.size() + numSkips * sizeof(SkipEntry));
+        const size_t gapsPos = bytes.size();
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            if (i == 0) {
+                encode(zigzag(static_cast<int64_t>(sorted[0]) - v));
+                continue;
+            }
+            if (i % blockSize == 0) {
+                const SkipEntry entry{static_cast<uint32_t>(bytes.size() - gapsPos), sorted[i - 1]};
+                std::memcpy(bytes.data() + tablePos + (i / blockSize - 1) * sizeof(SkipEntry), &entry, sizeof(entry));
+            }
+            encode(static_cast<uint64_t>(sorted[i] - sorted[i - 1]));
+        }
+    }
+};
+
+#endif //GRAPHS_CPP_VARINTROWS_H
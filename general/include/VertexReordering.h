@@ -0,0 +1,284 @@
+#ifndef GRAPHS_CPP_VERTEXREORDERING_H
+#define GRAPHS_CPP_VERTEXREORDERING_H
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "CompressedSparseRows.h"
+
+// Vertex orderings which place vertices that are used together next to each other in memory
+// The orderings are computed on symmetric adjacency rows (each edge v-w as v->w and w->v), which every graph module
+// can create for its graph types (e.g. graph::computeVertexOrder). Relabeling a graph with the resulting permutation
+// makes the adjacencies of neighbors and per-vertex arrays like distTo/edgeTo more likely to share cache lines.
+
+// Bijective mapping between the original vertex IDs of a graph and the new IDs of its relabeled copy
+class VertexPermutation {
+public:
+    // create empty permutation
+    VertexPermutation() = default;
+
+    // create permutation from the order of the original vertices (order[newId] = oldId)
+    explicit VertexPermutation(std::vector<int> order) : oldOfNew(std::move(order)), newOfOld(oldOfNew.size(), -1) {
+        for (size_t newId = 0; newId < oldOfNew.size(); ++newId) {
+            const int oldId = oldOfNew[newId];
+            if (oldId < 0 || static_cast<size_t>(oldId) >= oldOfNew.size() || newOfOld[oldId] != -1) {
+                throw std::invalid_argument("Order is not a permutation");
+            }
+            newOfOld[oldId] = static_cast<int>(newId);
+        }
+    }
+
+    // permutation which keeps all IDs
+    static VertexPermutation identity(const int V) {
+        std::vector<int> order(V);
+        for (int v = 0; v < V; ++v) order[v] = v;
+        return VertexPermutation(std::move(order));
+    }
+
+    // number of vertices
+    [[nodiscard]] int size() const {
+        return static_cast<int>(oldOfNew.size());
+    }
+
+    // new ID of original vertex oldId
+    [[nodiscard]] int toNew(const int oldId) const {
+        checkIndex(oldId);
+        return newOfOld[oldId];
+    }
+
+    // original ID of vertex newId
+    [[nodiscard]] int toOld(const int newId) const {
+        checkIndex(newId);
+        return oldOfNew[newId];
+    }
+
+    // translate vertices (e.g. a path) from new to original IDs
+    [[nodiscard]] std::vector<int> toOld(const std::vector<int>& newVertices) const {
+        std::vector<int> result(newVertices.size());
+        for (size_t i = 0; i < newVertices.size(); ++i) result[i] = toOld(newVertices[i]);
+        return result;
+    }
+
+    // translate vertices from original to new IDs
+    [[nodiscard]] std::vector<int> toNew(const std::vector<int>& oldVertices) const {
+        std::vector<int> result(oldVertices.size());
+        for (size_t i = 0; i < oldVertices.size(); ++i) result[i] = toNew(oldVertices[i]);
+        return result;
+    }
+
+    // reorder per-vertex values indexed by new ID so that they are indexed by original ID
+    template<typename T>
+    [[nodiscard]] std::vector<T> toOldOrder(const std::vector<T>& valuesByNewId) const {
+        if (valuesByNewId.size() != oldOfNew.size()) throw std::invalid_argument("Wrong number of values");
+        std::vector<T> result;
+        result.reserve(valuesByNewId.size());
+        for (const int newId : newOfOld) result.push_back(valuesByNewId[newId]);
+        return result;
+    }
+
+    // reorder per-vertex values indexed by original ID so that they are indexed by new ID
+    template<typename T>
+    [[nodiscard]] std::vector<T> toNewOrder(const std::vector<T>& valuesByOldId) const {
+        if (valuesByOldId.size() != oldOfNew.size()) throw std::invalid_argument("Wrong number of values");
+        std::vector<T> result;
+        result.reserve(valuesByOldId.size());
+        for (const int oldId : oldOfNew) result.push_back(valuesByOldId[oldId]);
+        return result;
+    }
+
+    // new ID of every original vertex
+    [[nodiscard]] const std::vector<int>& newIds() const {
+        return newOfOld;
+    }
+
+    // original ID of every new vertex
+    [[nodiscard]] const std::vector<int>& oldIds() const {
+        return oldOfNew;
+    }
+
+    // permutation which maps the new IDs back to the original ones
+    [[nodiscard]] VertexPermutation inverse() const {
+        return VertexPermutation(newOfOld);
+    }
+
+private:
+    std::vector<int> oldOfNew{}; // original ID of each new ID
+    std::vector<int> newOfOld{}; // new ID of each original ID
+
+    void checkIndex(const int v) const {
+        if (v < 0 || static_cast<size_t>(v) >= oldOfNew.size()) throw std::invalid_argument("Invalid vertex");
+    }
+};
+
+// available vertex orderings
+enum class VertexOrder {
+    ReverseCuthillMcKee, // BFS by ascending degree from peripheral vertices, reversed (small bandwidth)
+    DegreeDescending, // high-degree vertices (hubs) first
+    Bfs, // order of discovery with BFS
+    Dfs // order of discovery with DFS (preorder)
+};
+
+namespace internal {
+    // vertices sorted by ascending degree, ties by ID (counting sort)
+    inline std::vector<int> verticesByDegree(const CompressedSparseRows& rows) {
+        const int V = rows.numRows();
+        size_t maxDegree = 0;
+        for (int v = 0; v < V; ++v) maxDegree = std::max(maxDegree, rows.row(v).size());
+        std::vector<size_t> start(maxDegree + 2, 0);
+        for (int v = 0; v < V; ++v) ++start[rows.row(v).size() + 1];
+        for (size_t d = 0; d <= maxDegree; ++d) start[d + 1] += start[d];
+        std::vector<int> result(V);
+        for (int v = 0; v < V; ++v) result[start[rows.row(v).size()]++] = v;
+        return result;
+    }
+
+    // find a pseudo-peripheral vertex in the component of start (George-Liu algorithm):
+    // move to a vertex of minimum degree in the last BFS level as long as the eccentricity grows
+    inline int pseudoPeripheralVertex(const CompressedSparseRows& rows, int start, std::vector<int>& level) {
+        std::vector<int> queue{};
+        int eccentricity = -1;
+        while (true) {
+            queue.clear();
+            queue.push_back(start);
+            level[start] = 0;
+            for (size_t head = 0; head < queue.size(); ++head) {
+                const int v = queue[head];
+                for (const int w : rows.row(v)) {
+                    if (level[w] == -1) {
+                        level[w] = level[v] + 1;
+                        queue.push_back(w);
+                    }
+                }
+            }
+            const int newEccentricity = level[queue.back()];
+            int candidate = queue.back();
+            for (auto it = queue.rbegin(); it != queue.rend() && level[*it] == newEccentricity; ++it) {
+                if (rows.row(*it).size() < rows.row(candidate).size()) candidate = *it;
+            }
+            for (const int v : queue) level[v] = -1; // reset only touched vertices
+            if (newEccentricity <= eccentricity) return start;
+            eccentricity = newEccentricity;
+            start = candidate;
+        }
+    }
+}
+
+// Reverse Cuthill-McKee ordering (https://en.wikipedia.org/wiki/Cuthill%E2%80%93McKee_algorithm) in O(V+E log(maxDegree))
+// Each component is searched with BFS from a pseudo-peripheral vertex, visiting neighbors by ascending degree.
+inline std::vector<int> reverseCuthillMcKeeOrder(const CompressedSparseRows& rows) {
+    const int V = rows.numRows();
+    std::vector<int> order{}; // also used as BFS queue
+    order.reserve(V);
+    std::vector<char> visited(V, false);
+    std::vector<int> level(V, -1);
+    std::vector<int> neighbors{};
+    for (const int candidate : internal::verticesByDegree(rows)) {
+        if (visited[candidate]) continue;
+        const int start = internal::pseudoPeripheralVertex(rows, candidate, level);
+        visited[start] = true;
+        order.push_back(start);
+        for (size_t head = order.size() - 1; head < order.size(); ++head) {
+            neighbors.clear();
+            for (const int w : rows.row(order[head])) {
+                if (!visited[w]) {
+                    visited[w] = true;
+                    neighbors.push_back(w);
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end(), [&](const int a, const int b) {
+                return rows.row(a).size() != rows.row(b).size() ? rows.row(a).size() < rows.row(b).size() : a < b;
+            });
+            order.insert(order.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+// order by descending degree (ties by ID) in O(V)
+inline std::vector<int> degreeDescendingOrder(const CompressedSparseRows& rows) {
+    auto order = internal::verticesByDegree(rows);
+    // reverse runs of equal degree separately so that ties stay in ascending ID order
+    std::reverse(order.begin(), order.end());
+    for (auto runBegin = order.begin(); runBegin != order.end();) {
+        const size_t degree = rows.row(*runBegin).size();
+        auto runEnd = std::find_if(runBegin, order.end(), [&](const int v) { return rows.row(v).size() != degree; });
+        std::reverse(runBegin, runEnd);
+        runBegin = runEnd;
+    }
+    return order;
+}
+
+// order of discovery by BFS, starting at start and then at the lowest unvisited vertex of each other component
+inline std::vector<int> bfsOrder(const CompressedSparseRows& rows, const int start = 0) {
+    const int V = rows.numRows();
+    if (V > 0 && (start < 0 || start >= V)) throw std::invalid_argument("Invalid start vertex");
+    std::vector<int> order{}; // also used as BFS queue
+    order.reserve(V);
+    std::vector<char> visited(V, false);
+    const auto search = [&](const int root) {
+        if (visited[root]) return;
+        visited[root] = true;
+        order.push_back(root);
+        for (size_t head = order.size() - 1; head < order.size(); ++head) {
+            for (const int w : rows.row(order[head])) {
+                if (!visited[w]) {
+                    visited[w] = true;
+                    order.push_back(w);
+                }
+            }
+        }
+    };
+    if (V > 0) search(start);
+    for (int v = 0; v < V; ++v) search(v);
+    return order;
+}
+
+// order of discovery by iterative DFS (preorder), starting at start and then at the lowest unvisited vertex
+inline std::vector<int> dfsOrder(const CompressedSparseRows& rows, const int start = 0) {
+    const int V = rows.numRows();
+    if (V > 0 && (start < 0 || start >= V)) throw std::invalid_argument("Invalid start vertex");
+    std::vector<int> order{};
+    order.reserve(V);
+    std::vector<char> visited(V, false);
+    std::vector<std::pair<int, size_t>> stack{}; // vertex and index of next adjacent vertex to look at
+    const auto search = [&](const int root) {
+        if (visited[root]) return;
+        visited[root] = true;
+        order.push_back(root);
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            auto& [v, next] = stack.back();
+            const auto adjacent = rows.row(v);
+            while (next < adjacent.size() && visited[adjacent[next]]) ++next;
+            if (next == adjacent.size()) {
+                stack.pop_back();
+                continue;
+            }
+            const int w = adjacent[next++];
+            visited[w] = true;
+            order.push_back(w);
+            stack.emplace_back(w, 0);
+        }
+    };
+    if (V > 0) search(start);
+    for (int v = 0; v < V; ++v) search(v);
+    return order;
+}
+
+// compute permutation for one of the available orderings on symmetric adjacency rows
+inline VertexPermutation computeVertexOrder(const CompressedSparseRows& rows, const VertexOrder order) {
+    switch (order) {
+        case VertexOrder::ReverseCuthillMcKee:
+            return VertexPermutation(reverseCuthillMcKeeOrder(rows));
+        case VertexOrder::DegreeDescending:
+            return VertexPermutation(degreeDescendingOrder(rows));
+        case VertexOrder::Bfs:
+            return VertexPermutation(bfsOrder(rows));
+        case VertexOrder::Dfs:
+            return VertexPermutation(dfsOrder(rows));
+    }
+    throw std::invalid_argument("Unknown vertex order");
+}
+
+#endif //GRAPHS_CPP_VERTEXREORDERING_H
@@ -43,4 +43,24 @@ TEST(disjoint_sets, large) { // NOLINT
     EXPECT_TRUE(sets.connected(0, sets.size()-1));
     EXPECT_TRUE(sets.connected(0, sets.size()-2));
     EXPECT_TRUE(sets.connected(0, sets.size()-3));
-}
\ No newline at end of file
+}
+
+TEST(disjoint_sets, sizes_and_added_elements) { // NOLINT
+    DisjointSets sets(5);
+    EXPECT_EQ(sets.numSets(), 5);
+    EXPECT_TRUE(sets.setUnion(0, 1));
+    EXPECT_TRUE(sets.setUnion(2, 1));
+    EXPECT_FALSE(sets.setUnion(0, 2));
+    EXPECT_EQ(sets.numSets(), 3);
+    EXPECT_EQ(sets.setSize(0), 3);
+    EXPECT_EQ(sets.setSize(3), 1);
+
+    EXPECT_EQ(sets.addElement(), 5);
+    EXPECT_EQ(sets.size(), 6);
+    EXPECT_EQ(sets.numSets(), 4);
+    EXPECT_FALSE(sets.connected(5, 0));
+    EXPECT_TRUE(sets.setUnion(5, 0));
+    EXPECT_EQ(sets.setSize(2), 4);
+    EXPECT_EQ(sets.numSets(), 3);
+    EXPECT_ANY_THROW(static_cast<void>(sets.setSize(6)));
+}
@@ -0,0 +1,64 @@
+#include <random>
+#include <fstream>
+#include <cstdio>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "EdgeListLoader.h"
+
+TEST(edge_list_loader, small_inputs) { // NOLINT
+    const auto unweighted = parseEdgeList("4\n3\n0 1\n1 2\n  3   3\n", false, 2);
+    EXPECT_EQ(unweighted.numV, 4);
+    EXPECT_EQ(unweighted.numE, 3);
+    EXPECT_FALSE(unweighted.hasWeights);
+    EXPECT_EQ(unweighted.endpoints, (std::vector<int>{0, 1, 1, 2, 3, 3}));
+    EXPECT_EQ(unweighted.outDegree, (std::vector<int>{1, 1, 0, 1}));
+    EXPECT_EQ(unweighted.inDegree, (std::vector<int>{0, 1, 1, 1}));
+
+    const auto weighted = parseEdgeList("3 2 0 1 0.5\n2 1 -1e2", true);
+    EXPECT_TRUE(weighted.hasWeights);
+    EXPECT_EQ(weighted.endpoints, (std::vector<int>{0, 1, 2, 1}));
+    EXPECT_EQ(weighted.weights, (std::vector<double>{0.5, -100.0}));
+
+    EXPECT_THROW(parseEdgeList("", false), std::invalid_argument);
+    EXPECT_THROW(parseEdgeList("-1 0", false), std::invalid_argument);
+    EXPECT_THROW(parseEdgeList("2 x", false), std::invalid_argument);
+    EXPECT_THROW(parseEdgeList("2 2 0 1", false), std::invalid_argument); // missing edge
+    // missing edges are found before anything is allocated for the E of the header
+    EXPECT_THROW(parseEdgeList("2 2000000000 0 1", true), std::invalid_argument);
+    EXPECT_THROW(parseEdgeList("2 1 0 2", false), std::invalid_argument); // invalid vertex
+    EXPECT_THROW(parseEdgeList("2 1 0 1a", false), std::invalid_argument);
+    EXPECT_THROW(parseEdgeList("2 1 0 1 inf", true), std::invalid_argument);
+    EXPECT_THROW(loadEdgeList("does/not/exist.txt", false), std::runtime_error);
+}
+
+TEST(edge_list_loader, large_input_multiple_threads) { // NOLINT
+    // build large text in which chunk boundaries fall into the middle of lines
+    const int numV = 1000, numE = 60000;
+    std::mt19937 gen(3); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    std::vector<int> endpoints{};
+    std::vector<double> weights{};
+    std::string text = std::to_string(numV) + "\n" + std::to_string(numE) + "\n";
+    for (int i = 0; i < numE; ++i) {
+        endpoints.push_back(vertexDist(gen));
+        endpoints.push_back(vertexDist(gen));
+        weights.push_back(i * 0.25);
+        text += std::to_string(endpoints[2 * i]) + " " + std::to_string(endpoints[2 * i + 1]) + "\t" +
+                std::to_string(weights.back()) + "\n";
+    }
+
+    for (const unsigned threads : {1u, 3u, 8u}) {
+        const auto edgeList = parseEdgeList(text, true, threads);
+        EXPECT_EQ(edgeList.endpoints, endpoints);
+        EXPECT_EQ(edgeList.weights, weights);
+        EXPECT_EQ(std::accumulate(edgeList.outDegree.begin(), edgeList.outDegree.end(), 0), numE);
+    }
+
+    // same through a memory-mapped file
+    const std::string path = "test_edge_list_loader_tmp.txt";
+    std::ofstream(path) << text;
+    const auto fromFile = loadEdgeList(path, true, 4);
+    std::remove(path.c_str());
+    EXPECT_EQ(fromFile.endpoints, endpoints);
+    EXPECT_EQ(fromFile.weights, weights);
+}
@@ -0,0 +1,40 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include "SortedIntersection.h"
+
+// sorted set of up to n random values in [0, range)
+static std::vector<int> randomSet(std::mt19937& gen, const int n, const int range) {
+    std::uniform_int_distribution<int> dist(0, range - 1);
+    std::vector<int> result(n);
+    for (auto& x : result) x = dist(gen);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+TEST(sorted_intersection, small) { // NOLINT
+    const std::vector<int> a{1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+    const std::vector<int> b{2, 3, 4, 5, 6, 15, 16, 17, 18, 19, 20};
+    std::vector<int> common{};
+    forEachCommon(a, b, [&](const int x) { common.push_back(x); });
+    EXPECT_EQ(common, (std::vector<int>{3, 5, 15, 17, 19}));
+    EXPECT_EQ(intersectionSize(a, b), 5);
+    EXPECT_EQ(intersectionSize(a, {}), 0);
+    EXPECT_EQ(intersectionSize(a, a), a.size());
+}
+
+TEST(sorted_intersection, same_as_scalar) { // NOLINT
+    std::mt19937 gen(5);
+    for (int i = 0; i < 500; ++i) {
+        const int range = 10 + i * 3;
+        const auto a = randomSet(gen, i % 70, range);
+        const auto b = randomSet(gen, (i * 7) % 90, range);
+        std::vector<int> simd{}, scalar{};
+        forEachCommon(a, b, [&](const int x) { simd.push_back(x); });
+        forEachCommonScalar(a, b, [&](const int x) { scalar.push_back(x); });
+        ASSERT_EQ(simd, scalar);
+        ASSERT_EQ(intersectionSize(a, b), intersectionSizeScalar(a, b));
+        ASSERT_EQ(intersectionSize(b, a), scalar.size());
+    }
+}
@@ -0,0 +1,108 @@
+#include <random>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "StreamingConnectedComponents.h"
+#include "CompressedSparseRows.h"
+
+// random edge-list text with numV vertices and numE edges (weights if weighted)
+static std::string randomEdgeList(const int numV, const int numE, const bool weighted, std::vector<int>& endpoints) {
+    std::mt19937 gen(7); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    std::ostringstream oss;
+    oss << numV << "\n" << numE << "\n";
+    endpoints.clear();
+    for (int i = 0; i < numE; ++i) {
+        const int v = vertexDist(gen), w = vertexDist(gen);
+        endpoints.push_back(v);
+        endpoints.push_back(w);
+        oss << v << " " << w;
+        if (weighted) oss << " " << 0.25 * i;
+        oss << "\n";
+    }
+    return oss.str();
+}
+
+// component IDs numbered by smallest vertex, calculated with DisjointSets directly
+static std::vector<int> expectedIds(const int numV, const std::vector<int>& endpoints) {
+    DisjointSets sets(numV);
+    for (size_t i = 0; i < endpoints.size(); i += 2) sets.setUnion(endpoints[i], endpoints[i + 1]);
+    std::vector<int> idOfRoot(numV, -1), result(numV);
+    int numIds = 0;
+    for (int v = 0; v < numV; ++v) {
+        int& id = idOfRoot[sets.find(v)];
+        if (id == -1) id = numIds++;
+        result[v] = id;
+    }
+    return result;
+}
+
+TEST(streaming_connected_components, small) { // NOLINT
+    std::istringstream iss("6 3\n0 1\n2 1\n4 5\n");
+    auto cc = StreamingConnectedComponents::fromStream(iss, false);
+    EXPECT_EQ(cc.V(), 6);
+    EXPECT_EQ(cc.count(), 3);
+    EXPECT_TRUE(cc.connected(0, 2));
+    EXPECT_FALSE(cc.connected(0, 3));
+    EXPECT_EQ(cc.componentSize(1), 3);
+    EXPECT_EQ(cc.componentIds(), (std::vector<int>{0, 0, 0, 1, 2, 2}));
+    EXPECT_EQ(cc.componentSizes(), (std::vector<int>{3, 1, 2}));
+    cc.addEdge(3, 5);
+    EXPECT_EQ(cc.count(), 2);
+    EXPECT_ANY_THROW(cc.addEdge(0, 6));
+
+    std::istringstream missingEdge("3 2 0 1");
+    EXPECT_THROW(StreamingConnectedComponents::fromStream(missingEdge, false), std::invalid_argument);
+    std::istringstream invalidVertex("3 1 0 3");
+    EXPECT_THROW(StreamingConnectedComponents::fromStream(invalidVertex, false), std::invalid_argument);
+    std::istringstream invalidHeader("x 1");
+    EXPECT_THROW(StreamingConnectedComponents::fromStream(invalidHeader, false), std::invalid_argument);
+    EXPECT_THROW(StreamingConnectedComponents(-1), std::invalid_argument);
+
+    // more than INT_MAX edges are a valid header, so only the missing edges are reported
+    std::istringstream manyEdges("3 3000000000 0 1 1 2");
+    try {
+        static_cast<void>(StreamingConnectedComponents::fromStream(manyEdges, false));
+        FAIL() << "missing edges not detected";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_STREQ(e.what(), "Invalid format (edges)");
+    }
+}
+
+TEST(streaming_connected_components, same_for_all_sources) { // NOLINT
+    for (const bool weighted : {false, true}) {
+        std::vector<int> endpoints{};
+        const int numV = 3000;
+        const std::string text = randomEdgeList(numV, 1400, weighted, endpoints);
+        const auto expected = expectedIds(numV, endpoints);
+
+        // tiny buffers split many tokens
+        for (const size_t bufferSize : {size_t{64}, size_t{100}, size_t{1} << 20}) {
+            std::istringstream iss(text);
+            EXPECT_EQ(StreamingConnectedComponents::fromStream(iss, weighted, bufferSize).componentIds(), expected);
+        }
+
+        const std::string path = "test_streaming_connected_components_tmp.txt";
+        std::ofstream(path) << text;
+        EXPECT_EQ(StreamingConnectedComponents::fromFile(path, weighted).componentIds(), expected);
+        std::remove(path.c_str());
+    }
+}
+
+TEST(streaming_connected_components, snapshot) { // NOLINT
+    std::vector<int> endpoints{};
+    const int numV = 500;
+    randomEdgeList(numV, 300, false, endpoints);
+    const auto rows = CompressedSparseRows::fromEndpoints(numV, endpoints, false);
+    const std::string path = "test_streaming_connected_components_tmp.bin";
+    writeSnapshotFile(path, SnapshotType::Digraph, numV, static_cast<int>(endpoints.size() / 2),
+                      [&](const int v) { return rows.row(v).size(); },
+                      [&](const int v, const auto& write) {
+                          for (const int w : rows.row(v)) write(static_cast<int32_t>(w));
+                      });
+    auto cc = StreamingConnectedComponents::fromSnapshot(path, SnapshotType::Digraph);
+    EXPECT_EQ(cc.componentIds(), expectedIds(numV, endpoints));
+    EXPECT_THROW(StreamingConnectedComponents::fromSnapshot(path, SnapshotType::Graph), std::runtime_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,54 @@
+#include <random>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "VarintRows.h"
+
+TEST(varint_rows, round_trip) { // NOLINT
+    std::mt19937 gen(3); // NOLINT
+    // rows with small, large and repeated gaps, and rows with several skip blocks
+    std::vector<std::vector<int>> original{
+            {}, {0}, {5, 5, 5}, {2147483647, 0, 127, 128, 16383, 16384}, {}};
+    for (const int size : {63, 64, 65, 128, 129, 1000}) {
+        std::uniform_int_distribution<int> dist(0, size % 2 == 0 ? 200 : 1000000);
+        std::vector<int> row(size);
+        for (auto& w : row) w = dist(gen);
+        original.push_back(row);
+    }
+    const VarintRows rows(static_cast<int>(original.size()), [&](const int v) { return original[v]; });
+    EXPECT_EQ(rows.numRows(), static_cast<int>(original.size()));
+
+    size_t numEntries = 0;
+    for (int v = 0; v < rows.numRows(); ++v) {
+        auto sorted = original[v];
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT_EQ(rows.row(v).toVector(), sorted);
+        EXPECT_EQ(rows.row(v).size(), sorted.size());
+        EXPECT_EQ(rows.rowSize(v), sorted.size());
+        numEntries += sorted.size();
+
+        // contains for all elements and for the values between them
+        for (const int w : sorted) EXPECT_TRUE(rows.contains(v, w));
+        std::uniform_int_distribution<int> dist(0, 1000001);
+        for (int i = 0; i < 200; ++i) {
+            const int w = dist(gen);
+            EXPECT_EQ(rows.contains(v, w), std::binary_search(sorted.begin(), sorted.end(), w));
+        }
+    }
+    EXPECT_EQ(rows.numEntries(), numEntries);
+
+    const std::vector<int> negative{1, -1};
+    EXPECT_THROW(VarintRows(1, [&](int) { return negative; }), std::invalid_argument);
+}
+
+TEST(varint_rows, small_gaps_need_one_byte) { // NOLINT
+    // path-like rows with neighbors v-1 and v+1
+    const int numRows = 10000;
+    const VarintRows rows(numRows, [](const int v) {
+        std::vector<int> row{};
+        if (v > 0) row.push_back(v - 1);
+        if (v + 1 < numRows) row.push_back(v + 1);
+        return row;
+    });
+    // 32-bit row offset + one byte each for the number of targets, the first target (relative to v) and the gap
+    EXPECT_LE(rows.memoryBytes(), (numRows / VarintRows::rowsPerBase + 1) * sizeof(uint64_t) + 7 * static_cast<size_t>(numRows));
+}
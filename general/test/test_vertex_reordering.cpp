@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include <numeric>
+#include <random>
+#include "VertexReordering.h"
+
+// symmetric rows of a path 0-1-2-...-(n-1) whose vertices are renamed with a random permutation
+static CompressedSparseRows shuffledPath(const int n, std::vector<int>& names) {
+    names.resize(n);
+    std::iota(names.begin(), names.end(), 0);
+    std::shuffle(names.begin(), names.end(), std::mt19937(7));
+    std::vector<int> endpoints{};
+    for (int i = 0; i + 1 < n; ++i) {
+        endpoints.push_back(names[i]);
+        endpoints.push_back(names[i + 1]);
+    }
+    return CompressedSparseRows::fromEndpoints(n, endpoints, true);
+}
+
+// largest difference of the positions of adjacent vertices in order
+static int bandwidth(const CompressedSparseRows& rows, const VertexPermutation& permutation) {
+    int result = 0;
+    for (int v = 0; v < rows.numRows(); ++v) {
+        for (const int w : rows.row(v)) {
+            result = std::max(result, std::abs(permutation.toNew(v) - permutation.toNew(w)));
+        }
+    }
+    return result;
+}
+
+TEST(vertex_reordering, permutation) { // NOLINT
+    const VertexPermutation permutation(std::vector<int>{2, 0, 1});
+    EXPECT_EQ(permutation.size(), 3);
+    EXPECT_EQ(permutation.toOld(0), 2);
+    EXPECT_EQ(permutation.toNew(2), 0);
+    EXPECT_EQ(permutation.newIds(), (std::vector<int>{1, 2, 0}));
+    EXPECT_EQ(permutation.inverse().oldIds(), permutation.newIds());
+    EXPECT_EQ(permutation.toOld(std::vector<int>{0, 1}), (std::vector<int>{2, 0}));
+    EXPECT_EQ(permutation.toOldOrder(std::vector<char>{'a', 'b', 'c'}), (std::vector<char>{'b', 'c', 'a'}));
+    EXPECT_EQ(permutation.toNewOrder(permutation.toOldOrder(std::vector<int>{5, 6, 7})), (std::vector<int>{5, 6, 7}));
+    EXPECT_EQ(VertexPermutation::identity(4).toNew(3), 3);
+    EXPECT_THROW(static_cast<void>(permutation.toNew(3)), std::invalid_argument);
+    EXPECT_THROW(VertexPermutation(std::vector<int>{0, 0, 1}), std::invalid_argument);
+    EXPECT_THROW(VertexPermutation(std::vector<int>{0, 3}), std::invalid_argument);
+}
+
+TEST(vertex_reordering, orders_are_permutations) { // NOLINT
+    std::vector<int> names;
+    const auto rows = shuffledPath(100, names);
+    for (const auto order : {VertexOrder::ReverseCuthillMcKee, VertexOrder::DegreeDescending,
+                             VertexOrder::Bfs, VertexOrder::Dfs}) {
+        EXPECT_EQ(computeVertexOrder(rows, order).size(), 100);
+    }
+    EXPECT_EQ(computeVertexOrder(CompressedSparseRows{}, VertexOrder::ReverseCuthillMcKee).size(), 0);
+}
+
+TEST(vertex_reordering, reverse_cuthill_mckee_restores_path) { // NOLINT
+    std::vector<int> names;
+    const auto rows = shuffledPath(1000, names);
+    EXPECT_GT(bandwidth(rows, VertexPermutation::identity(1000)), 1);
+    const auto permutation = computeVertexOrder(rows, VertexOrder::ReverseCuthillMcKee);
+    EXPECT_EQ(bandwidth(rows, permutation), 1);
+    // the search starts at an end of the path
+    const int first = permutation.toOld(0);
+    EXPECT_TRUE(first == names.front() || first == names.back());
+}
+
+TEST(vertex_reordering, degree_and_search_orders) { // NOLINT
+    // star with center 3 and leaves 0, 1, 2, plus edge 4-5
+    const auto rows = CompressedSparseRows::fromEndpoints(6, {3, 0, 3, 1, 3, 2, 4, 5}, true);
+    EXPECT_EQ(degreeDescendingOrder(rows), (std::vector<int>{3, 0, 1, 2, 4, 5}));
+    EXPECT_EQ(bfsOrder(rows, 1), (std::vector<int>{1, 3, 0, 2, 4, 5}));
+    EXPECT_EQ(dfsOrder(rows, 5), (std::vector<int>{5, 4, 0, 3, 1, 2}));
+    EXPECT_THROW(static_cast<void>(bfsOrder(rows, 6)), std::invalid_argument);
+}
@@ -0,0 +1,100 @@
+#ifndef DIGRAPHS_CPP_COMPRESSEDDIGRAPH_H
+#define DIGRAPHS_CPP_COMPRESSEDDIGRAPH_H
+
+#include "Digraph.h"
+#include "CompressedSparseRows.h"
+#include "VarintRows.h"
+
+namespace digraph {
+
+    // Immutable digraph whose sorted adjacencies are stored as varint-encoded gaps (see VarintRows.h)
+    // Adjacent vertices are decoded while iterating, so adj(v) returns a range instead of an ArrayView and the class
+    // does not implement the Digraph interface. The algorithm templates (see GraphConcept.h) such as
+    // StronglyConnectedComponents run on it directly.
+    // Relabel the digraph with a cache-friendly vertex order first (see DigraphReordering.h) to get small gaps.
+    class CompressedDigraph {
+    public:
+        // create compressed copy of another digraph (adjacent vertices are sorted)
+        template<typename DG, EnableIfGraphLike<DG> = 0>
+        explicit CompressedDigraph(const DG& dg) : numV(dg.V()), numE(dg.E()),
+                                                   rows(dg.V(), [&dg](const int v) { return uncheckedAdj(dg, v); }) {}
+
+        // create digraph with input stream (same format as AdjacencyListDigraph)
+        explicit CompressedDigraph(std::istream& is) {
+            const auto endpoints = ::internal::readEdgeEndpoints(is, numV, numE);
+            rows = fromCsr(CompressedSparseRows::fromEndpoints(numV, endpoints, false));
+        }
+
+        // create digraph from an edge list (see EdgeListLoader.h)
+        explicit CompressedDigraph(const EdgeList& edgeList) :
+                numV(edgeList.numV), numE(edgeList.numE),
+                rows(fromCsr(CompressedSparseRows::fromEndpoints(edgeList.numV, edgeList.endpoints, false))) {}
+
+        // get vertices adjacent to v in ascending order
+        [[nodiscard]] VarintRows::Row adj(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return rows.row(v);
+        }
+
+        // get vertices adjacent to v in ascending order without bounds check (see GraphConcept.h)
+        [[nodiscard]] VarintRows::Row adjUnchecked(const int v) const {
+            return rows.row(v);
+        }
+
+        // number of edges starting at v
+        [[nodiscard]] int degree(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return static_cast<int>(rows.rowSize(v));
+        }
+
+        // whether edge v->w exists (decodes at most one block of the adjacencies of v)
+        [[nodiscard]] bool hasEdge(const int v, const int w) const {
+            if (!vertexValid(v) || !vertexValid(w)) throw std::invalid_argument("Invalid vertex");
+            return rows.contains(v, w);
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const {
+            return numV;
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const {
+            return numE;
+        }
+
+        // bytes used by the adjacencies
+        [[nodiscard]] size_t memoryBytes() const {
+            return rows.memoryBytes();
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const {
+            std::stringstream ss;
+            ss << "[Digraph with " << numV << " vertices and " << numE << " edges]\n";
+            for (int i = 0; i < numV; ++i) {
+                for (const auto edge : rows.row(i)) {
+                    ss << i << "->" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(const int v) const {
+            return v >= 0 && v < numV;
+        }
+
+    private:
+        int numV = 0; // vertices
+        int numE = 0; // edges
+        VarintRows rows{}; // adjacencies of all vertices (one entry per edge)
+
+        static VarintRows fromCsr(const CompressedSparseRows& csr) {
+            return VarintRows(csr.numRows(), [&csr](const int v) { return csr.row(v); });
+        }
+    };
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_COMPRESSEDDIGRAPH_H
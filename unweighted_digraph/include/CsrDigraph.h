@@ -0,0 +1,117 @@
+#ifndef DIGRAPHS_CPP_CSRDIGRAPH_H
+#define DIGRAPHS_CPP_CSRDIGRAPH_H
+
+#include "Digraph.h"
+#include "CompressedSparseRows.h"
+
+namespace digraph {
+
+    // Immutable digraph in compressed sparse row (CSR) format (https://en.wikipedia.org/wiki/Sparse_matrix)
+    // All adjacencies are stored in one contiguous array instead of one vector per vertex.
+    class CsrDigraph : public Digraph {
+    public:
+        // create frozen copy of another digraph (keeps the order of adjacent vertices)
+        explicit CsrDigraph(const Digraph& dg) : numV(dg.V()), numE(dg.E()) {
+            std::vector<size_t> offsets(static_cast<size_t>(numV) + 1, 0);
+            for (int v = 0; v < numV; ++v) {
+                offsets[v + 1] = offsets[v] + dg.adj(v).size();
+            }
+            std::vector<int> targets{};
+            targets.reserve(offsets.back());
+            for (int v = 0; v < numV; ++v) {
+                const auto adjacent = dg.adj(v);
+                targets.insert(targets.end(), adjacent.begin(), adjacent.end());
+            }
+            rows = CompressedSparseRows(std::move(offsets), std::move(targets));
+        }
+
+        // create digraph with input stream (same format as AdjacencyListDigraph)
+        explicit CsrDigraph(std::istream& is) {
+            const auto endpoints = ::internal::readEdgeEndpoints(is, numV, numE);
+            rows = CompressedSparseRows::fromEndpoints(numV, endpoints, false);
+        }
+
+        // create digraph from an edge list (see EdgeListLoader.h)
+        explicit CsrDigraph(const EdgeList& edgeList) :
+                numV(edgeList.numV), numE(edgeList.numE),
+                rows(CompressedSparseRows::fromEndpoints(edgeList.numV, edgeList.endpoints, false)) {}
+
+        // create digraph with V vertices from already built rows (one entry per edge)
+        CsrDigraph(const int V, CompressedSparseRows&& _rows) :
+                numV(V), numE(static_cast<int>(_rows.numEntries())), rows(std::move(_rows)) {
+            if (rows.numRows() != numV) throw std::invalid_argument("Number of rows must match V");
+        }
+
+        // CSR digraphs cannot be changed after creation
+        void addEdge(int, int) override {
+            throw std::logic_error("CsrDigraph is immutable");
+        }
+
+        // get vertices adjacent to v
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return rows.row(v);
+        }
+
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return rows.row(v);
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const override {
+            return numV;
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const override {
+            return numE;
+        }
+
+        // reverse of this digraph (a view of the in-edge index)
+        [[nodiscard]] std::unique_ptr<Digraph> reverse() const override {
+            return std::make_unique<ReverseDigraphView>(inEdges());
+        }
+
+        // get vertices with an edge to v
+        [[nodiscard]] ArrayView<int> inAdj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return inEdges()->row(v);
+        }
+
+        // in-edge index (transpose of the rows, built with counting sort on first use)
+        [[nodiscard]] std::shared_ptr<const CompressedSparseRows> inEdges() const override {
+            return inEdgeCache.get([this] { return rows.transpose(); });
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const override {
+            std::stringstream ss;
+            ss << "[Digraph with " << numV << " vertices and " << numE << " edges]\n";
+            for (int i = 0; i < numV; ++i) {
+                for (const auto edge : rows.row(i)) {
+                    ss << i << "->" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(int v) const override {
+            return v >= 0 && v < numV;
+        }
+
+    private:
+        int numV = 0; // vertices
+        int numE = 0; // edges
+        CompressedSparseRows rows{}; // adjacencies of all vertices
+        internal::InEdgeCache inEdgeCache{};
+    };
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_CSRDIGRAPH_H
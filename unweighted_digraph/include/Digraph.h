@@ -3,10 +3,18 @@
 
 #include <vector>
 #include <memory>
+#include <type_traits>
 #include <sstream>
 #include <deque>
-#include <unordered_set>
 #include <stack>
+#include <optional>
+#include <iostream>
+#include <stdexcept>
+#include "ArrayView.h"
+#include "EdgeList.h"
+#include "CompressedSparseRows.h"
+#include "GraphConcept.h"
+#include "DirectedDfs.h"
 #include "PrintHelpers.h"
 
 namespace digraph {
@@ -15,15 +23,151 @@ namespace digraph {
     class Digraph {
     public:
         virtual void addEdge(int v, int w) = 0; // add edge v->w to graph
-        [[nodiscard]] virtual const std::vector<int> &adj(int v) const = 0; // get vertices adjacent to v
+        [[nodiscard]] virtual ArrayView<int> adj(int v) const = 0; // get vertices adjacent to v
         [[nodiscard]] virtual int V() const = 0; // number of vertices
         [[nodiscard]] virtual int E() const = 0; // number of edges
         [[nodiscard]] virtual std::unique_ptr<Digraph> reverse() const = 0; // reverse of this digraph
+        [[nodiscard]] virtual ArrayView<int> inAdj(int v) const = 0; // get vertices with an edge to v
+        // in-edge index in CSR format, built once and shared (row w contains v for every edge v->w)
+        [[nodiscard]] virtual std::shared_ptr<const CompressedSparseRows> inEdges() const = 0;
         [[nodiscard]] virtual std::string toString() const = 0; // create string representation
         [[nodiscard]] virtual bool vertexValid(int v) const = 0; // whether a vertex exists
         virtual ~Digraph() = default; // virtual destructor
     };
 
+    namespace internal {
+        // adjacencies of the reverse of dg in CSR format
+        // (row w contains v for every edge v->w, in ascending order of v)
+        template<typename DG>
+        CompressedSparseRows reverseRows(const DG& dg) {
+            std::vector<size_t> offsets(static_cast<size_t>(dg.V()) + 1, 0);
+            for (int v = 0; v < dg.V(); ++v) {
+                for (const int w : uncheckedAdj(dg, v)) ++offsets[w + 1];
+            }
+            for (int v = 0; v < dg.V(); ++v) offsets[v + 1] += offsets[v];
+            std::vector<int> targets(offsets.back());
+            std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+            for (int v = 0; v < dg.V(); ++v) {
+                for (const int w : uncheckedAdj(dg, v)) targets[next[w]++] = v;
+            }
+            return CompressedSparseRows(std::move(offsets), std::move(targets));
+        }
+
+        // Lazily built in-edge index of a digraph, which is dropped when the digraph changes
+        // Reverse views and algorithms hold their own reference, so an index stays valid while it is in use. Concurrent
+        // first calls of get may both build an index, but only the first one is stored and returned to every caller.
+        class InEdgeCache {
+        public:
+            // cached index, or the one returned by build() if there is none yet
+            template<typename Build>
+            std::shared_ptr<const CompressedSparseRows> get(Build&& build) const {
+                auto rows = std::atomic_load(&cached);
+                if (!rows) {
+                    rows = std::make_shared<const CompressedSparseRows>(build());
+                    // views from inAdj are owned only by the cache, so a losing builder drops its copy
+                    std::shared_ptr<const CompressedSparseRows> stored{};
+                    if (!std::atomic_compare_exchange_strong(&cached, &stored, rows)) rows = std::move(stored);
+                }
+                return rows;
+            }
+
+            // drop the cached index (e.g. after adding an edge)
+            void invalidate() {
+                std::atomic_store(&cached, std::shared_ptr<const CompressedSparseRows>{});
+            }
+
+        private:
+            mutable std::shared_ptr<const CompressedSparseRows> cached{};
+        };
+
+        // in-edge index of dg: the cached one of Digraph implementations, or else a new one
+        template<typename DG>
+        std::shared_ptr<const CompressedSparseRows> inEdgeRows(const DG& dg) {
+            if constexpr (std::is_base_of_v<Digraph, DG>) {
+                return dg.inEdges();
+            } else {
+                return std::make_shared<const CompressedSparseRows>(reverseRows(dg));
+            }
+        }
+    }
+
+    // Reverse of a digraph as an immutable view of its in-edge index (see Digraph::inEdges), without copying edges
+    // The view shares the index, so it stays valid (and unchanged) if the original digraph changes later.
+    class ReverseDigraphView : public Digraph {
+    public:
+        // view of the digraph whose adjacencies are the rows of in-edge index rows
+        explicit ReverseDigraphView(std::shared_ptr<const CompressedSparseRows> _rows) : rows(std::move(_rows)) {
+            if (!rows) throw std::invalid_argument("Rows must not be empty");
+        }
+
+        // reverse views cannot be changed
+        void addEdge(int, int) override {
+            throw std::logic_error("ReverseDigraphView is immutable");
+        }
+
+        // get vertices adjacent to v, i.e. the vertices with an edge to v in the original digraph
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return rows->row(v);
+        }
+
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return rows->row(v);
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const override {
+            return rows->numRows();
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const override {
+            return static_cast<int>(rows->numEntries());
+        }
+
+        // reverse of this view (a view of the transposed rows)
+        [[nodiscard]] std::unique_ptr<Digraph> reverse() const override {
+            return std::make_unique<ReverseDigraphView>(inEdges());
+        }
+
+        // get vertices with an edge to v
+        [[nodiscard]] ArrayView<int> inAdj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return inEdges()->row(v);
+        }
+
+        // in-edge index, i.e. the transposed rows (built on first use)
+        [[nodiscard]] std::shared_ptr<const CompressedSparseRows> inEdges() const override {
+            return inEdgeCache.get([this] { return rows->transpose(); });
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const override {
+            std::stringstream ss;
+            ss << "[Digraph with " << V() << " vertices and " << E() << " edges]\n";
+            for (int i = 0; i < V(); ++i) {
+                for (const auto edge : rows->row(i)) {
+                    ss << i << "->" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(int v) const override {
+            return v >= 0 && v < V();
+        }
+
+    private:
+        std::shared_ptr<const CompressedSparseRows> rows; // adjacencies of all vertices
+        internal::InEdgeCache inEdgeCache{};
+    };
+
     // Graph built with adjacency list
     class AdjacencyListDigraph : public Digraph {
     public:
@@ -48,6 +192,19 @@ namespace digraph {
             }
         }
 
+        // create digraph from an edge list (see EdgeListLoader.h) with exactly reserved adjacency vectors
+        explicit AdjacencyListDigraph(const EdgeList& edgeList) :
+                numV(edgeList.numV),
+                numE(edgeList.numE),
+                adjacencies(edgeList.numV, std::vector<int>{}) {
+            for (int v = 0; v < numV; ++v) {
+                adjacencies[v].reserve(edgeList.outDegree[v]);
+            }
+            for (size_t i = 0; i < edgeList.endpoints.size(); i += 2) {
+                adjacencies[edgeList.endpoints[i]].push_back(edgeList.endpoints[i + 1]);
+            }
+        }
+
         // add edge v->w to graph
         void addEdge(int v, int w) override {
             if (!vertexValid(v) || !vertexValid(w)) {
@@ -55,16 +212,22 @@ namespace digraph {
             }
             adjacencies[v].push_back(w);
             ++numE;
+            inEdgeCache.invalidate();
         }
 
         // get vertices adjacent to v
-        [[nodiscard]] const std::vector<int> &adj(int v) const override {
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
             if (!vertexValid(v)) {
                 throw std::invalid_argument("Invalid vertex");
             }
             return adjacencies[v];
         }
 
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return adjacencies[v];
+        }
+
         // number of vertices
         [[nodiscard]] int V() const override {
             return numV;
@@ -75,15 +238,22 @@ namespace digraph {
             return numE;
         }
 
-        // reverse of this digraph
+        // reverse of this digraph (a view of the in-edge index)
         [[nodiscard]] std::unique_ptr<Digraph> reverse() const override {
-            std::unique_ptr<Digraph> rdg = std::make_unique<AdjacencyListDigraph>(this->V());
-            for(int from=0; from < this->V(); ++from) {
-                for(const int to : this->adj(from)) {
-                    rdg->addEdge(to, from); // add reverse edge
-                }
+            return std::make_unique<ReverseDigraphView>(inEdges());
+        }
+
+        // get vertices with an edge to v (valid until the next addEdge, use inEdges() for many lookups)
+        [[nodiscard]] ArrayView<int> inAdj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
             }
-            return rdg;
+            return inEdges()->row(v);
+        }
+
+        // in-edge index (built with counting sort on first use, dropped by addEdge)
+        [[nodiscard]] std::shared_ptr<const CompressedSparseRows> inEdges() const override {
+            return inEdgeCache.get([this] { return internal::reverseRows(*this); });
         }
 
         // create string representation
@@ -107,143 +277,83 @@ namespace digraph {
         int numV = 0; // vertices
         int numE = 0; // edges
         std::vector <std::vector<int>> adjacencies{}; // vector with V elements each of size outDegree(vertex) to represent edges
+        internal::InEdgeCache inEdgeCache{};
 
     };
 
-    namespace internal {
-        bool containsCycleRec(const Digraph& dg, const int v, std::deque<bool>& visited,
-                              std::vector<int>& edgeTo,
-                              std::unordered_set<int>& onStack, std::stack<int>& cycle) {
-            onStack.insert(v);
-            for(const int other : dg.adj(v)) {
-                if (!visited[other]) {
-                    visited[other] = true;
-                    edgeTo[other] = v;
-                    onStack.insert(other);
-                    if(containsCycleRec(dg, other, visited, edgeTo, onStack, cycle)) {
-                        return true;
-                    }
-                } else if(onStack.find(other) != onStack.end()) {
-                    // other is already visited AND on stack -> cycle
-                    // save cycle
-                    for(int x=v; x != other; x = edgeTo[x]) {
-                        cycle.push(x);
-                    }
-                    cycle.push(other);
-                    cycle.push(v);
-                    return true;
-                }
-            }
-            onStack.erase(v);
-            return false;
-        }
-    }
-
-    // check whether digraph contains a cycle
+    // check whether digraph contains a cycle (iterative three-color DFS, see DirectedDfs.h)
     // returns cycle or nothing
-    std::optional<std::vector<int>> containsCycle(const Digraph& dg) {
-        std::deque<bool> visited(dg.V(), false);
-        std::vector<int> edgeTo(dg.V(), -1);
-        std::unordered_set<int> onStack{}; // whether a node is currently on the stack
-        std::stack<int> cycle{}; // cycle (if one exists)
-        // loop through a vertices
-        bool cycleFound = false;
-        for(int v=0; v < dg.V(); ++v) {
-            if(!visited[v]) {
-                visited[v] = true;
-                if(internal::containsCycleRec(dg, v, visited, edgeTo, onStack, cycle)) {
-                    cycleFound = true;
-                    break;
-                }
-            }
-            onStack.clear(); // clear onStack as the next recursion will be for a new connected component
-        }
-
-        if(cycleFound) {
-            std::vector<int> cycleVec{};
-            while(!cycle.empty()) {
-                cycleVec.push_back(cycle.top());
-                cycle.pop();
-            }
-            return {cycleVec};
-        } else {
-            return {};
-        }
-    }
-
-    namespace internal {
-        void topologicalSortRec(const Digraph& dg, const int v,
-                                std::deque<bool>& visited, std::stack<int>& reversePostOrder) {
-            visited[v] = true;
-            for(const int other : dg.adj(v)) {
-                if(!visited[other]) {
-                    topologicalSortRec(dg, other, visited, reversePostOrder);
-                }
-            }
-            reversePostOrder.push(v);
-        }
+    inline std::optional<std::vector<int>> containsCycle(const Digraph& dg) {
+        return ::internal::directedDfs(dg, [](const int w) { return w; }).cycle;
     }
 
-    // calculate a topological sort of digraph (reverse DFS postorder)
+    // calculate a topological sort of digraph (reverse DFS postorder), found in the same DFS as a cycle
     // digraph must be acyclic!
-    std::vector<int> topologicalSort(const Digraph& dg) {
-        if(const auto cycle = containsCycle(dg); cycle) {
+    inline std::vector<int> topologicalSort(const Digraph& dg) {
+        auto dfs = ::internal::directedDfs(dg, [](const int w) { return w; });
+        if(dfs.cycle) {
             std::cout<<std::flush;
             std::cerr<<"Digraph contains cycle - cannot do topological sort: ";
-            print_vec(*cycle, "->", "\n", std::cerr);
+            print_vec(*dfs.cycle, "->", "\n", std::cerr);
             std::cerr<<std::flush;
             throw std::invalid_argument("Digraph must be acyclic");
         }
-
-        std::deque<bool> visited(dg.V(), false);
-        std::stack<int> reversePostOrder{};
-        for(int v=0; v<dg.V(); ++v) {
-            if(!visited[v]) {
-                internal::topologicalSortRec(dg, v, visited, reversePostOrder);
-            }
-        }
-
-        std::vector<int> result{};
-        while(!reversePostOrder.empty()) {
-            result.push_back(reversePostOrder.top());
-            reversePostOrder.pop();
-        }
-
-        return result;
+        return std::move(dfs.reversePostorder);
     }
 
+    // algorithms for calculating strongly connected components
+    enum class SccAlgorithm {
+        KosarajuSharir, // two DFS passes, the first one over a CSR copy of the reverse digraph
+        Pearce // Tarjan's algorithm in Pearce's variant: one iterative DFS with O(V) extra memory, no copy of the edges
+    };
+
     // calculates strongly connected components (each node reachable from each node) with Kosaraju-Sharir algorithm
+    // or Pearce's algorithm
+    // Both algorithms of the constructor number the components in reverse topological order of the condensation, i.e.
+    // compId[v] >= compId[w] for every edge v->w, but the IDs of unrelated components may differ between them.
+    // Components calculated elsewhere (e.g. digraph::stronglyConnectedComponentsParallel) are created with fromLabels
+    // and numbered in order of their smallest vertex instead, which is not a topological order in general.
     class StronglyConnectedComponents {
     public:
-        explicit StronglyConnectedComponents(const Digraph& dg) : compId(dg.V(), -1), numComp{0} {
-            const auto pReverse = dg.reverse();
-            // (1) calculate reverse postorder of reverse digraph with DFS
-            std::stack<int> reversePostorder;
-            std::deque<bool> visited(pReverse->V(), false);
-            for(int i=0; i < pReverse->V(); ++i) {
-                if(!visited[i]) {
-                    dfsReverseGraph(*pReverse, i, visited, reversePostorder);
-                }
+        // calculate strong components of dg (for all digraph types, see GraphConcept.h)
+        template<typename DG, EnableIfGraphLike<DG> = 0>
+        explicit StronglyConnectedComponents(const DG& dg,
+                                             const SccAlgorithm algorithm = SccAlgorithm::KosarajuSharir) :
+                compId(dg.V(), -1), numComp{0} {
+            if (algorithm == SccAlgorithm::Pearce) {
+                pearce(dg);
+            } else {
+                kosarajuSharir(dg);
             }
+        }
 
-            // (2) run DFS in (non-reverse) digraph with order given by reversePostorder
-            std::fill(visited.begin(), visited.end(), false);
-            std::vector<int> edgeTo(dg.V(), -1);
-            while(!reversePostorder.empty()) {
-                const int v = reversePostorder.top();
-                reversePostorder.pop();
-                if (!visited[v]) {
-                    compId[v] = numComp;
-                    dfsNormalGraph(dg, v, visited, edgeTo);
-                    ++numComp;
+        // components from a label in [0, V) for each vertex (vertices with the same label form a component), numbered
+        // in order of their smallest vertex
+        static StronglyConnectedComponents fromLabels(const std::vector<int>& label) {
+            StronglyConnectedComponents result{};
+            result.compId.assign(label.size(), -1);
+            std::vector<int> idOfLabel(label.size(), -1);
+            for(size_t v = 0; v < label.size(); ++v) {
+                if(label[v] < 0 || static_cast<size_t>(label[v]) >= label.size()) {
+                    throw std::invalid_argument("Invalid label");
                 }
+                int& id = idOfLabel[label[v]];
+                if(id == -1) id = result.numComp++;
+                result.compId[v] = id;
             }
+            return result;
         }
 
         [[nodiscard]] int numberOfComponents() const {
             return numComp;
         }
 
+        // ID of the strong component of v
+        [[nodiscard]] int id(const int v) const {
+            if(v < 0 || static_cast<size_t>(v) >= compId.size()) throw std::invalid_argument("invalid vertex ID");
+            return compId[v];
+        }
+
         // whether v and w are strongly connected
         [[nodiscard]] bool stronglyConnected(const int v, const int w) const {
             if(v < 0 || static_cast<size_t>(v) >= compId.size() || w < 0 || static_cast<size_t>(w) >= compId.size()) {
@@ -265,10 +375,104 @@ namespace digraph {
         std::vector<int> compId; // ID of strong component for each vertex
         int numComp; // number of strong components
 
+        StronglyConnectedComponents() : compId{}, numComp{0} {}
+
+        // Kosaraju-Sharir: DFS in the reverse digraph for the reverse postorder, then DFS in dg in that order
+        template<typename DG>
+        void kosarajuSharir(const DG& dg) {
+            const auto reverseIndex = internal::inEdgeRows(dg);
+            const CompressedSparseRows& reverse = *reverseIndex;
+            // (1) calculate reverse postorder of reverse digraph with DFS
+            std::stack<int> reversePostorder;
+            std::deque<bool> visited(dg.V(), false);
+            for(int i=0; i < dg.V(); ++i) {
+                if(!visited[i]) {
+                    dfsReverseGraph(reverse, i, visited, reversePostorder);
+                }
+            }
+
+            // (2) run DFS in (non-reverse) digraph with order given by reversePostorder
+            std::fill(visited.begin(), visited.end(), false);
+            std::vector<int> edgeTo(dg.V(), -1);
+            while(!reversePostorder.empty()) {
+                const int v = reversePostorder.top();
+                reversePostorder.pop();
+                if (!visited[v]) {
+                    compId[v] = numComp;
+                    dfsNormalGraph(dg, v, visited, edgeTo);
+                    ++numComp;
+                }
+            }
+        }
+
+        // Pearce's algorithm (https://doi.org/10.1016/j.ipl.2015.08.010) with an explicit DFS stack: rindex[v] is the
+        // DFS index of v, lowered to the smallest index reachable from v while v is active, and the (large) component
+        // ID once the component of v is complete (counted down from V-1, so that it never mixes with DFS indices)
+        template<typename DG>
+        void pearce(const DG& dg) {
+            const int V = dg.V();
+            using Iterator = decltype(uncheckedAdj(dg, 0).begin());
+            struct Frame {
+                int v;
+                Iterator next; // next adjacency of v to look at
+                Iterator end;
+                bool root; // whether no vertex with a smaller index was reached from v so far
+            };
+            std::vector<int>& rindex = compId; // reused for the result
+            std::fill(rindex.begin(), rindex.end(), 0); // 0: not visited yet
+            std::vector<int> component{}; // visited vertices whose component is not complete yet
+            std::vector<Frame> dfs{};
+            int index = 1;
+            int c = V - 1;
+            const auto visit = [&](const int v) {
+                rindex[v] = index++;
+                const auto adj = uncheckedAdj(dg, v);
+                dfs.push_back({v, adj.begin(), adj.end(), true});
+            };
+            for (int s = 0; s < V; ++s) {
+                if (rindex[s] != 0) continue;
+                visit(s);
+                while (!dfs.empty()) {
+                    Frame& frame = dfs.back();
+                    const int v = frame.v;
+                    if (frame.next != frame.end) {
+                        const int w = *frame.next;
+                        if (rindex[w] == 0) {
+                            visit(w); // frame is invalid now, w is finished before v continues with w
+                            continue;
+                        }
+                        ++frame.next;
+                        if (rindex[w] < rindex[v]) {
+                            rindex[v] = rindex[w];
+                            frame.root = false;
+                        }
+                        continue;
+                    }
+                    // all adjacencies of v were visited
+                    const bool root = frame.root;
+                    dfs.pop_back();
+                    if (root) {
+                        --index;
+                        while (!component.empty() && rindex[v] <= rindex[component.back()]) {
+                            rindex[component.back()] = c;
+                            component.pop_back();
+                            --index;
+                        }
+                        rindex[v] = c--;
+                    } else {
+                        component.push_back(v);
+                    }
+                }
+            }
+            // components were completed in reverse topological order with IDs V-1, V-2, ...
+            numComp = V - 1 - c;
+            for (int& id : rindex) id = V - 1 - id;
+        }
+
         // DFS for reverse digraph to calculate reverse postorder
-        static void dfsReverseGraph(const Digraph& reverseDg, const int v, std::deque<bool>& visited, std::stack<int>& reversePostorder) {
+        static void dfsReverseGraph(const CompressedSparseRows& reverseDg, const int v, std::deque<bool>& visited, std::stack<int>& reversePostorder) {
             visited[v] = true;
-            for(const int other : reverseDg.adj(v)) {
+            for(const int other : reverseDg.row(v)) {
                 if(!visited[other]) {
                     dfsReverseGraph(reverseDg, other, visited, reversePostorder);
                 }
@@ -277,9 +481,10 @@ namespace digraph {
         }
 
         // DFS for normal digraph to calculate strong components
-        void dfsNormalGraph(const Digraph& dg, const int v, std::deque<bool>& visited, std::vector<int>& edgeTo) {
+        template<typename DG>
+        void dfsNormalGraph(const DG& dg, const int v, std::deque<bool>& visited, std::vector<int>& edgeTo) {
             visited[v] = true;
-            for(const int other : dg.adj(v)) {
+            for(const int other : uncheckedAdj(dg, v)) {
                 if(!visited[other]) {
                     edgeTo[other] = v;
                     compId[other] = compId[v];
@@ -0,0 +1,26 @@
+#ifndef DIGRAPHS_CPP_DIGRAPHBETWEENNESS_H
+#define DIGRAPHS_CPP_DIGRAPHBETWEENNESS_H
+
+#include "Digraph.h"
+#include "BetweennessCentrality.h"
+
+namespace digraph {
+
+    // betweenness centrality of every vertex with Brandes' algorithm (see BetweennessCentrality.h) in O(VE) on
+    // numThreads threads (0: default number of threads), i.e. over the directed shortest paths of all ordered pairs
+    template<typename DG, EnableIfGraphLike<DG> = 0>
+    std::vector<double> betweennessCentrality(const DG& dg, const unsigned numThreads = 0) {
+        return ::internal::unweightedBetweenness(dg, ::internal::allSources, 0, numThreads);
+    }
+
+    // estimate of the betweenness centrality from numSamples random sources (with random generator seed), which
+    // takes O(numSamples*E) instead of O(VE)
+    template<typename DG, EnableIfGraphLike<DG> = 0>
+    std::vector<double> approximateBetweennessCentrality(const DG& dg, const int numSamples,
+                                                         const unsigned numThreads = 0, const uint32_t seed = 1234) {
+        return ::internal::unweightedBetweenness(dg, numSamples, seed, numThreads);
+    }
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_DIGRAPHBETWEENNESS_H
@@ -0,0 +1,49 @@
+#ifndef DIGRAPHS_CPP_DIGRAPHREORDERING_H
+#define DIGRAPHS_CPP_DIGRAPHREORDERING_H
+
+#include "Digraph.h"
+#include "CsrDigraph.h"
+#include "VertexReordering.h"
+
+namespace digraph {
+
+    // adjacencies of dg without directions (v->w as v->w and w->v) as compressed sparse rows
+    inline CompressedSparseRows toSymmetricRows(const Digraph& dg) {
+        std::vector<int> endpoints{};
+        endpoints.reserve(2 * static_cast<size_t>(dg.E()));
+        for (int v = 0; v < dg.V(); ++v) {
+            for (const int w : dg.adj(v)) {
+                endpoints.push_back(v);
+                endpoints.push_back(w);
+            }
+        }
+        return CompressedSparseRows::fromEndpoints(dg.V(), endpoints, true);
+    }
+
+    // compute a cache-friendly vertex order of dg, ignoring edge directions (see VertexReordering.h)
+    inline VertexPermutation computeVertexOrder(const Digraph& dg, const VertexOrder order) {
+        return ::computeVertexOrder(toSymmetricRows(dg), order);
+    }
+
+    // copy of dg in CSR format where vertex v is called permutation.toNew(v)
+    // the adjacent vertices of each vertex are sorted by their new IDs
+    inline CsrDigraph relabel(const Digraph& dg, const VertexPermutation& permutation) {
+        if (permutation.size() != dg.V()) throw std::invalid_argument("Permutation does not match digraph");
+        std::vector<size_t> offsets(static_cast<size_t>(dg.V()) + 1, 0);
+        for (int newId = 0; newId < dg.V(); ++newId) {
+            offsets[newId + 1] = offsets[newId] + dg.adj(permutation.toOld(newId)).size();
+        }
+        std::vector<int> targets(offsets.back());
+        for (int newId = 0; newId < dg.V(); ++newId) {
+            auto pos = targets.begin() + static_cast<std::ptrdiff_t>(offsets[newId]);
+            for (const int w : dg.adj(permutation.toOld(newId))) {
+                *pos++ = permutation.toNew(w);
+            }
+            std::sort(targets.begin() + static_cast<std::ptrdiff_t>(offsets[newId]), pos);
+        }
+        return CsrDigraph(dg.V(), CompressedSparseRows(std::move(offsets), std::move(targets)));
+    }
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_DIGRAPHREORDERING_H
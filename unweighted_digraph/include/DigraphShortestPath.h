@@ -0,0 +1,43 @@
+#ifndef DIGRAPHS_CPP_DIGRAPHSHORTESTPATH_H
+#define DIGRAPHS_CPP_DIGRAPHSHORTESTPATH_H
+
+#include "Digraph.h"
+#include "BidirectionalBfs.h"
+
+namespace digraph {
+
+    // shortest directed path (fewest edges) from s to t with bidirectional BFS, or an empty vector if there is none
+    // The backward search from t walks the edges of reverseDg, which must be the reverse of dg. Pass the same reverse
+    // digraph and workspace to many queries to avoid rebuilding the reverse and resetting per-vertex arrays.
+    inline std::vector<int> shortestPath(const Digraph& dg, const Digraph& reverseDg, const int s, const int t,
+                                         BidirectionalBfsWorkspace& workspace) {
+        if (dg.V() != reverseDg.V() || dg.E() != reverseDg.E()) {
+            throw std::invalid_argument("reverseDg is not the reverse of dg");
+        }
+        return ::internal::bidirectionalBfsPath(dg.V(), s, t,
+                                                [&dg](const int v) { return dg.adj(v); },
+                                                [&reverseDg](const int v) { return reverseDg.adj(v); },
+                                                workspace);
+    }
+
+    // shortest directed path (fewest edges) from s to t with bidirectional BFS, or an empty vector if there is none
+    // The backward search walks the cached in-edge index of dg (see Digraph::inEdges).
+    inline std::vector<int> shortestPath(const Digraph& dg, const int s, const int t,
+                                         BidirectionalBfsWorkspace& workspace) {
+        const auto in = dg.inEdges();
+        return ::internal::bidirectionalBfsPath(dg.V(), s, t,
+                                                [&dg](const int v) { return dg.adj(v); },
+                                                [&in](const int v) { return in->row(v); },
+                                                workspace);
+    }
+
+    // shortest directed path (fewest edges) from s to t with bidirectional BFS, or an empty vector if there is none
+    inline std::vector<int> shortestPath(const Digraph& dg, const int s, const int t) {
+        if (!dg.vertexValid(s) || !dg.vertexValid(t)) throw std::invalid_argument("Invalid vertex");
+        BidirectionalBfsWorkspace workspace{};
+        return shortestPath(dg, s, t, workspace);
+    }
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_DIGRAPHSHORTESTPATH_H
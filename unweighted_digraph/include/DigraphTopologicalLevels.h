@@ -0,0 +1,19 @@
+#ifndef DIGRAPHS_CPP_DIGRAPHTOPOLOGICALLEVELS_H
+#define DIGRAPHS_CPP_DIGRAPHTOPOLOGICALLEVELS_H
+
+#include "Digraph.h"
+#include "TopologicalLevels.h"
+
+namespace digraph {
+
+    // topological sort of dg split into levels of mutually independent vertices with Kahn's algorithm (see
+    // TopologicalLevels.h) on numThreads threads (0: default number of threads)
+    // If dg has a cycle, the result is not acyclic() and contains one cycle() instead of all vertices.
+    template<typename DG, EnableIfGraphLike<DG> = 0>
+    TopologicalLevels topologicalLevels(const DG& dg, const unsigned numThreads = 0) {
+        return {dg, [](const int w) { return w; }, numThreads};
+    }
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_DIGRAPHTOPOLOGICALLEVELS_H
@@ -0,0 +1,61 @@
+#ifndef DIGRAPHS_CPP_INCREMENTALTOPOLOGICALORDER_H
+#define DIGRAPHS_CPP_INCREMENTALTOPOLOGICALORDER_H
+
+#include "Digraph.h"
+#include "DynamicTopologicalOrder.h"
+
+namespace digraph {
+
+    // DAG with adjacency lists which keeps a topological order up to date while edges are added
+    // (Pearce-Kelly, see DynamicTopologicalOrder.h), instead of running topologicalSort after each change
+    // Edges which would close a cycle are rejected and not added.
+    class IncrementalTopologicalOrderDigraph : public AdjacencyListDigraph {
+    public:
+        // create digraph with V vertices
+        explicit IncrementalTopologicalOrderDigraph(const int V) : AdjacencyListDigraph(V), topological(V) {}
+
+        // create digraph with input stream (must be acyclic)
+        explicit IncrementalTopologicalOrderDigraph(std::istream& is) :
+                AdjacencyListDigraph(is), topological(asAdjacencyList(), [](const int w) { return w; }) {}
+
+        // create digraph from an edge list (see EdgeListLoader.h, must be acyclic)
+        explicit IncrementalTopologicalOrderDigraph(const EdgeList& edgeList) :
+                AdjacencyListDigraph(edgeList), topological(asAdjacencyList(), [](const int w) { return w; }) {}
+
+        // add edge v->w to digraph and update the topological order, or throw if v->w would close a cycle
+        void addEdge(const int v, const int w) override {
+            if (!tryAddEdge(v, w)) throw std::invalid_argument("Edge v->w would create a cycle");
+        }
+
+        // add edge v->w to digraph and update the topological order and return true, or return false without changes
+        // if v->w would close a cycle
+        bool tryAddEdge(const int v, const int w) {
+            if (!vertexValid(v) || !vertexValid(w)) throw std::invalid_argument("Cannot create edge v-w");
+            if (!topological.insert(asAdjacencyList(), v, w, [](const int x) { return x; })) return false;
+            AdjacencyListDigraph::addEdge(v, w);
+            return true;
+        }
+
+        // all vertices in topological order
+        [[nodiscard]] const std::vector<int>& topologicalOrder() const {
+            return topological.order();
+        }
+
+        // position of v in the topological order
+        [[nodiscard]] int position(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return topological.positionOf(v);
+        }
+
+    private:
+        ::internal::DynamicTopologicalOrder topological;
+
+        // this digraph with non-virtual adjacencies for the searches
+        [[nodiscard]] const AdjacencyListDigraph& asAdjacencyList() const {
+            return *this;
+        }
+    };
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_INCREMENTALTOPOLOGICALORDER_H
@@ -0,0 +1,106 @@
+#ifndef DIGRAPHS_CPP_MAPPEDDIGRAPH_H
+#define DIGRAPHS_CPP_MAPPEDDIGRAPH_H
+
+#include "Digraph.h"
+#include "CsrDigraph.h"
+#include "GraphSnapshot.h"
+
+namespace digraph {
+
+    // write binary snapshot of dg to path (see GraphSnapshot.h), which can be opened with MappedDigraph
+    inline void writeSnapshot(const Digraph& dg, const std::string& path) {
+        writeSnapshotFile(path, SnapshotType::Digraph, dg.V(), dg.E(),
+                          [&](const int v) { return dg.adj(v).size(); },
+                          [&](const int v, const auto& write) {
+                              for (const int w : dg.adj(v)) write(static_cast<int32_t>(w));
+                          });
+    }
+
+    // Immutable digraph which uses a memory-mapped snapshot file directly (zero-copy)
+    // Opening maps the file and checks its header and row offsets in O(V), but not the adjacencies. Call validate()
+    // before using a file which may be corrupt, as invalid vertices in it lead to undefined behavior.
+    // The pages are loaded on first access and shared with all other processes which map the same file.
+    class MappedDigraph : public Digraph {
+    public:
+        // map snapshot at path (created with writeSnapshot)
+        explicit MappedDigraph(const std::string& path) : file(path, SnapshotType::Digraph),
+                                                          offsets(file.rowOffsets()), targets(file.entries<int>()) {}
+
+        // mapped digraphs cannot be changed
+        void addEdge(int, int) override {
+            throw std::logic_error("MappedDigraph is immutable");
+        }
+
+        // get vertices adjacent to v
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return {targets.data() + offsets[v], static_cast<size_t>(offsets[v + 1] - offsets[v])};
+        }
+
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return {targets.data() + offsets[v], static_cast<size_t>(offsets[v + 1] - offsets[v])};
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const override {
+            return file.V();
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const override {
+            return file.E();
+        }
+
+        // reverse of this digraph (a view of the in-edge index)
+        [[nodiscard]] std::unique_ptr<Digraph> reverse() const override {
+            return std::make_unique<ReverseDigraphView>(inEdges());
+        }
+
+        // get vertices with an edge to v
+        [[nodiscard]] ArrayView<int> inAdj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return inEdges()->row(v);
+        }
+
+        // in-edge index (built in memory with counting sort on first use)
+        [[nodiscard]] std::shared_ptr<const CompressedSparseRows> inEdges() const override {
+            return inEdgeCache.get([this] { return internal::reverseRows(*this); });
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const override {
+            std::stringstream ss;
+            ss << "[Digraph with " << V() << " vertices and " << E() << " edges]\n";
+            for (int i = 0; i < V(); ++i) {
+                for (const auto edge : adj(i)) {
+                    ss << i << "->" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(int v) const override {
+            return v >= 0 && v < file.V();
+        }
+
+        // check the whole file for invalid offsets or vertices in O(V+E)
+        void validate() const {
+            file.validateRows();
+        }
+
+    private:
+        SnapshotFile file; // mapped snapshot
+        ArrayView<uint64_t> offsets; // start of each row in targets (V+1 elements)
+        ArrayView<int> targets; // adjacencies of all vertices
+        internal::InEdgeCache inEdgeCache{};
+    };
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_MAPPEDDIGRAPH_H
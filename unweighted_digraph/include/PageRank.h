@@ -0,0 +1,157 @@
+#ifndef DIGRAPHS_CPP_PAGERANK_H
+#define DIGRAPHS_CPP_PAGERANK_H
+
+#include <cmath>
+#include <numeric>
+#include "Digraph.h"
+#include "Parallel.h"
+
+namespace digraph {
+
+    namespace internal {
+        // sum of values[indices[i]] over all indices, with four independent accumulators so that the additions of
+        // consecutive in-neighbors do not wait for each other (and can be vectorized as gathers)
+        inline double gatherSum(const double* values, const ArrayView<int> indices) {
+            const int* idx = indices.data();
+            const size_t n = indices.size();
+            double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                s0 += values[idx[i]];
+                s1 += values[idx[i + 1]];
+                s2 += values[idx[i + 2]];
+                s3 += values[idx[i + 3]];
+            }
+            for (; i < n; ++i) s0 += values[idx[i]];
+            return (s0 + s1) + (s2 + s3);
+        }
+    }
+
+    // PageRank (https://en.wikipedia.org/wiki/PageRank) of all vertices with power iteration
+    // Every iteration is a pull-based sparse matrix-vector product: each vertex sums up rank/outdegree of its
+    // in-neighbors from the CSR transpose of the digraph, so vertices are computed independently on numThreads threads
+    // (0: default number of threads) without atomics. The rank of vertices without out-edges (dangling vertices) is
+    // redistributed like a teleport. Iterations stop when the L1 norm of the change is below tolerance.
+    class PageRank {
+    public:
+        // PageRank with uniform teleport probabilities (for all digraph types, see GraphConcept.h)
+        template<typename DG, EnableIfGraphLike<DG> = 0>
+        explicit PageRank(const DG& dg, const double damping = 0.85, const double tolerance = 1e-9,
+                          const int maxIterations = 100, const unsigned numThreads = 0) :
+                PageRank(dg, std::vector<double>(dg.V(), 1.0), damping, tolerance, maxIterations, numThreads) {}
+
+        // personalized PageRank: random jumps (and jumps from dangling vertices) go to vertex v with a probability
+        // proportional to personalization[v], e.g. 1 for a set of seed vertices and 0 for all others
+        template<typename DG, EnableIfGraphLike<DG> = 0>
+        PageRank(const DG& dg, const std::vector<double>& personalization, const double damping = 0.85,
+                 const double tolerance = 1e-9, const int maxIterations = 100, const unsigned numThreads = 0) {
+            const int V = dg.V();
+            if (static_cast<int>(personalization.size()) != V) {
+                throw std::invalid_argument("Personalization must have one value per vertex");
+            }
+            if (!(damping >= 0.0 && damping < 1.0)) throw std::invalid_argument("Damping must be in [0, 1)");
+            if (!(tolerance > 0.0)) throw std::invalid_argument("Tolerance must be positive");
+            if (maxIterations < 0) throw std::invalid_argument("Number of iterations must not be negative");
+            double personalizationSum = 0.0;
+            for (const double p : personalization) {
+                if (!(p >= 0.0) || std::isinf(p)) throw std::invalid_argument("Personalization must be non-negative");
+                personalizationSum += p;
+            }
+            if (V > 0 && !(personalizationSum > 0.0)) throw std::invalid_argument("Personalization must not be zero");
+
+            std::vector<double> teleport(V);
+            for (int v = 0; v < V; ++v) teleport[v] = personalization[v] / personalizationSum;
+            const auto inIndex = internal::inEdgeRows(dg);
+            const CompressedSparseRows& inRows = *inIndex;
+            std::vector<double> inverseOutDegree(V);
+            parallelFor(0, V, numThreads, [&](const size_t v, unsigned) {
+                const size_t outDegree = uncheckedAdj(dg, static_cast<int>(v)).size();
+                inverseOutDegree[v] = outDegree > 0 ? 1.0 / static_cast<double>(outDegree) : 0.0;
+            }, chunk);
+
+            struct alignas(64) PaddedSum {
+                double value = 0.0;
+            };
+            std::vector<PaddedSum> partial(resolveNumThreads(numThreads));
+            const auto sumPartial = [&] {
+                double total = 0.0;
+                for (auto& p : partial) {
+                    total += p.value;
+                    p.value = 0.0;
+                }
+                return total;
+            };
+
+            ranks = teleport;
+            std::vector<double> contribution(V);
+            std::vector<double> next(V);
+            while (numIterations < maxIterations) {
+                // rank passed along each out-edge, and total rank of dangling vertices
+                parallelFor(0, V, numThreads, [&](const size_t v, const unsigned threadId) {
+                    contribution[v] = ranks[v] * inverseOutDegree[v];
+                    if (inverseOutDegree[v] == 0.0) partial[threadId].value += ranks[v];
+                }, chunk);
+                const double dangling = sumPartial();
+
+                // pull contributions of in-neighbors
+                parallelFor(0, V, numThreads, [&](const size_t v, const unsigned threadId) {
+                    const double sum = internal::gatherSum(contribution.data(), inRows.row(static_cast<int>(v)));
+                    next[v] = (1.0 - damping + damping * dangling) * teleport[v] + damping * sum;
+                    partial[threadId].value += std::abs(next[v] - ranks[v]);
+                }, chunk);
+                ranks.swap(next);
+                ++numIterations;
+                if (sumPartial() < tolerance) {
+                    hasConverged = true;
+                    break;
+                }
+            }
+        }
+
+        // PageRank of vertex v
+        [[nodiscard]] double rank(const int v) const {
+            if (v < 0 || v >= static_cast<int>(ranks.size())) throw std::invalid_argument("Invalid vertex");
+            return ranks[v];
+        }
+
+        // PageRank of all vertices (sums up to 1)
+        [[nodiscard]] const std::vector<double>& allRanks() const {
+            return ranks;
+        }
+
+        // up to k vertices with the highest PageRank in descending order of rank (ties: smaller vertex first)
+        [[nodiscard]] std::vector<int> top(const int k) const {
+            if (k < 0) throw std::invalid_argument("k must not be negative");
+            std::vector<int> result(ranks.size());
+            std::iota(result.begin(), result.end(), 0);
+            const auto numResults = std::min(result.size(), static_cast<size_t>(k));
+            const auto higher = [&](const int v, const int w) {
+                return ranks[v] > ranks[w] || (ranks[v] == ranks[w] && v < w);
+            };
+            std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(numResults), result.end(),
+                              higher);
+            result.resize(numResults);
+            return result;
+        }
+
+        // number of power iterations which were done
+        [[nodiscard]] int iterations() const {
+            return numIterations;
+        }
+
+        // whether the change of the last iteration was below the tolerance
+        [[nodiscard]] bool converged() const {
+            return hasConverged;
+        }
+
+    private:
+        static constexpr size_t chunk = 1024; // vertices per chunk of parallelFor
+
+        std::vector<double> ranks{};
+        int numIterations = 0;
+        bool hasConverged = false;
+    };
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_PAGERANK_H
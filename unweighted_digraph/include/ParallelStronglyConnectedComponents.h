@@ -0,0 +1,230 @@
+#ifndef DIGRAPHS_CPP_PARALLELSTRONGLYCONNECTEDCOMPONENTS_H
+#define DIGRAPHS_CPP_PARALLELSTRONGLYCONNECTEDCOMPONENTS_H
+
+#include <atomic>
+#include <cstdint>
+#include "Digraph.h"
+#include "Parallel.h"
+
+namespace digraph {
+
+    namespace internal {
+        // State of the multi-threaded strong components algorithm (see stronglyConnectedComponentsParallel)
+        // label[v] is -1 while the component of v is unknown, and afterwards a vertex of the component. All phases only
+        // look at the edges between vertices without label (the remaining subgraph), which contains all remaining
+        // components completely.
+        template<typename DG>
+        class ParallelStrongComponents {
+        public:
+            ParallelStrongComponents(const DG& _dg, const unsigned numThreads) :
+                    dg(_dg), in(inEdgeRows(_dg)), threads(resolveNumThreads(numThreads)), label(_dg.V()),
+                    color(_dg.V()), inDegree(_dg.V()), outDegree(_dg.V()), mark(_dg.V()), local(threads) {
+                remaining.resize(dg.V());
+                parallelFor(0, dg.V(), threads, [&](const size_t v, unsigned) {
+                    label[v].store(-1, std::memory_order_relaxed);
+                    mark[v].store(0, std::memory_order_relaxed);
+                    remaining[v] = static_cast<int>(v);
+                }, chunk);
+            }
+
+            // label of every vertex
+            std::vector<int> run() {
+                trim();
+                if (!remaining.empty()) forwardBackward(pivot());
+                while (!remaining.empty()) {
+                    trim();
+                    if (!remaining.empty()) coloring();
+                }
+                std::vector<int> result(dg.V());
+                parallelFor(0, dg.V(), threads, [&](const size_t v, unsigned) {
+                    result[v] = label[v].load(std::memory_order_relaxed);
+                }, chunk);
+                return result;
+            }
+
+        private:
+            static constexpr size_t chunk = 1024; // vertices per chunk of parallelFor
+
+            const DG& dg;
+            const std::shared_ptr<const CompressedSparseRows> in; // in-edges of every vertex
+            const unsigned threads;
+            std::vector<std::atomic<int>> label;
+            std::vector<std::atomic<int>> color; // largest vertex which reaches a vertex (coloring phase)
+            std::vector<std::atomic<int>> inDegree; // in-edges from the remaining subgraph (trim phase)
+            std::vector<std::atomic<int>> outDegree; // out-edges into the remaining subgraph (trim phase)
+            std::vector<std::atomic<uint8_t>> mark; // reached forward (1) or backward (2), or queued (coloring phase)
+            std::vector<int> remaining{}; // vertices without label
+            std::vector<std::vector<int>> local; // output of each thread
+
+            [[nodiscard]] bool unlabeled(const int v) const {
+                return label[v].load(std::memory_order_relaxed) == -1;
+            }
+
+            // run fn(v, out) for all v in vertices in parallel, where out collects vertices for the result
+            template<typename Fn>
+            std::vector<int> collect(const std::vector<int>& vertices, Fn&& fn, const size_t chunkSize = chunk) {
+                parallelFor(0, vertices.size(), threads, [&](const size_t i, const unsigned threadId) {
+                    fn(vertices[i], local[threadId]);
+                }, chunkSize);
+                std::vector<int> result{};
+                for (auto& out : local) {
+                    result.insert(result.end(), out.begin(), out.end());
+                    out.clear();
+                }
+                return result;
+            }
+
+            void removeLabeled() {
+                remaining = collect(remaining, [&](const int v, std::vector<int>& out) {
+                    if (unlabeled(v)) out.push_back(v);
+                });
+            }
+
+            // Trimming: a vertex without in-edges or without out-edges in the remaining subgraph is a component of its
+            // own. Removing it can trim its neighbors, so trimmed vertices are peeled off in rounds like in Kahn's
+            // algorithm. This removes most of the (usually very many) single-vertex components of real digraphs.
+            void trim() {
+                const auto countDegrees = [&](const int v) {
+                    int numIn = 0, numOut = 0;
+                    for (const int u : in->row(v)) numIn += unlabeled(u) ? 1 : 0;
+                    for (const int w : uncheckedAdj(dg, v)) numOut += unlabeled(w) ? 1 : 0;
+                    inDegree[v].store(numIn, std::memory_order_relaxed);
+                    outDegree[v].store(numOut, std::memory_order_relaxed);
+                };
+                parallelFor(0, remaining.size(), threads, [&](const size_t i, unsigned) {
+                    countDegrees(remaining[i]);
+                }, chunk);
+                const auto claim = [&](const int v) {
+                    int expected = -1;
+                    return label[v].compare_exchange_strong(expected, v, std::memory_order_relaxed);
+                };
+                auto frontier = collect(remaining, [&](const int v, std::vector<int>& out) {
+                    if ((inDegree[v].load(std::memory_order_relaxed) == 0 ||
+                         outDegree[v].load(std::memory_order_relaxed) == 0) && claim(v)) {
+                        out.push_back(v);
+                    }
+                });
+                while (!frontier.empty()) {
+                    frontier = collect(frontier, [&](const int v, std::vector<int>& out) {
+                        for (const int w : uncheckedAdj(dg, v)) {
+                            if (inDegree[w].fetch_sub(1, std::memory_order_relaxed) == 1 && claim(w)) out.push_back(w);
+                        }
+                        for (const int u : in->row(v)) {
+                            if (outDegree[u].fetch_sub(1, std::memory_order_relaxed) == 1 && claim(u)) out.push_back(u);
+                        }
+                    }, 64);
+                }
+                removeLabeled();
+            }
+
+            // remaining vertex with the largest product of in- and out-degree (probably in the largest component)
+            [[nodiscard]] int pivot() const {
+                int best = remaining.front();
+                int64_t bestProduct = -1;
+                for (const int v : remaining) {
+                    const int64_t product = static_cast<int64_t>(inDegree[v].load(std::memory_order_relaxed)) *
+                                            outDegree[v].load(std::memory_order_relaxed);
+                    if (product > bestProduct) {
+                        bestProduct = product;
+                        best = v;
+                    }
+                }
+                return best;
+            }
+
+            // level-synchronous BFS from source over the remaining subgraph, which sets bit in mark of reached vertices
+            template<typename AdjOf>
+            void markReachable(const int source, const uint8_t bit, AdjOf&& adjOf) {
+                mark[source].fetch_or(bit, std::memory_order_relaxed);
+                std::vector<int> frontier{source};
+                while (!frontier.empty()) {
+                    frontier = collect(frontier, [&](const int v, std::vector<int>& out) {
+                        for (const int w : adjOf(v)) {
+                            if (unlabeled(w) && (mark[w].fetch_or(bit, std::memory_order_relaxed) & bit) == 0) {
+                                out.push_back(w);
+                            }
+                        }
+                    }, 64);
+                }
+            }
+
+            // Forward-backward: the component of p consists of the vertices which are reachable from p and from which
+            // p is reachable. A single pivot usually finds the giant component of real digraphs in parallel BFS steps.
+            void forwardBackward(const int p) {
+                markReachable(p, 1, [&](const int v) { return uncheckedAdj(dg, v); });
+                markReachable(p, 2, [&](const int v) { return in->row(v); });
+                parallelFor(0, remaining.size(), threads, [&](const size_t i, unsigned) {
+                    const int v = remaining[i];
+                    if (mark[v].load(std::memory_order_relaxed) == 3) label[v].store(p, std::memory_order_relaxed);
+                    mark[v].store(0, std::memory_order_relaxed);
+                }, chunk);
+                removeLabeled();
+            }
+
+            // Coloring (Orzan): the largest vertex which reaches v is propagated along the edges as the color of v
+            // until nothing changes. Every vertex c with color c is the largest vertex of its component, which consists
+            // of the vertices with color c that reach c. The backward searches of all such c run in parallel, as they
+            // visit disjoint colors, and at least one component is completed in each round.
+            void coloring() {
+                parallelFor(0, remaining.size(), threads, [&](const size_t i, unsigned) {
+                    color[remaining[i]].store(remaining[i], std::memory_order_relaxed);
+                }, chunk);
+                auto active = remaining;
+                while (!active.empty()) {
+                    parallelFor(0, active.size(), threads, [&](const size_t i, unsigned) {
+                        mark[active[i]].store(0, std::memory_order_relaxed); // not queued anymore
+                    }, chunk);
+                    active = collect(active, [&](const int v, std::vector<int>& out) {
+                        const int c = color[v].load(std::memory_order_relaxed);
+                        for (const int w : uncheckedAdj(dg, v)) {
+                            if (!unlabeled(w)) continue;
+                            int current = color[w].load(std::memory_order_relaxed);
+                            bool raised = false;
+                            while (current < c) {
+                                if (color[w].compare_exchange_weak(current, c, std::memory_order_relaxed)) {
+                                    raised = true;
+                                    break;
+                                }
+                            }
+                            if (raised && mark[w].exchange(1, std::memory_order_relaxed) == 0) out.push_back(w);
+                        }
+                    }, 64);
+                }
+
+                const auto roots = collect(remaining, [&](const int v, std::vector<int>& out) {
+                    if (color[v].load(std::memory_order_relaxed) == v) out.push_back(v);
+                });
+                parallelFor(0, roots.size(), threads, [&](const size_t i, unsigned) {
+                    const int c = roots[i];
+                    std::vector<int> stack{c};
+                    label[c].store(c, std::memory_order_relaxed);
+                    while (!stack.empty()) {
+                        const int v = stack.back();
+                        stack.pop_back();
+                        for (const int u : in->row(v)) {
+                            if (unlabeled(u) && color[u].load(std::memory_order_relaxed) == c) {
+                                label[u].store(c, std::memory_order_relaxed);
+                                stack.push_back(u);
+                            }
+                        }
+                    }
+                }, 1);
+                removeLabeled();
+            }
+        };
+    } // namespace internal
+
+    // Multi-threaded strongly connected components on numThreads threads (0: default number of threads), without DFS
+    // (1) Trimming of vertices without in- or out-edges, which are components of their own
+    // (2) Forward-backward search from one pivot, which usually finds the giant component
+    // (3) Coloring for the many small remaining components, alternating with trimming
+    // The partition is the same as the one of StronglyConnectedComponents(dg), but the components are numbered in order
+    // of their smallest vertex (see StronglyConnectedComponents::fromLabels).
+    template<typename DG, EnableIfGraphLike<DG> = 0>
+    StronglyConnectedComponents stronglyConnectedComponentsParallel(const DG& dg, const unsigned numThreads = 0) {
+        return StronglyConnectedComponents::fromLabels(internal::ParallelStrongComponents<DG>(dg, numThreads).run());
+    }
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_PARALLELSTRONGLYCONNECTEDCOMPONENTS_H
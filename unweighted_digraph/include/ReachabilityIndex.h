@@ -0,0 +1,229 @@
+#ifndef DIGRAPHS_CPP_REACHABILITYINDEX_H
+#define DIGRAPHS_CPP_REACHABILITYINDEX_H
+
+#include <random>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include "Digraph.h"
+
+namespace digraph {
+
+    // Index for queries whether there is a directed path from u to v, built in O(k(V+E))
+    // (1) The strong components are condensed into a DAG (vertices of a component reach each other). Their IDs are in
+    //     reverse topological order, so a component can only reach components with smaller or equal IDs.
+    // (2) GRAIL (Yildirim et al., 2010) labels every component c with k intervals [low, post] from k randomized DFS
+    //     traversals of the DAG: post is the postorder rank of c and low the smallest rank below c. If c reaches d,
+    //     the intervals of d are contained in the ones of c, so most negative queries are answered by comparing labels.
+    // (3) Otherwise, a DFS from u's component only follows components whose labels contain the ones of v's component.
+    // The index takes O(kV) memory besides the condensation. Queries keep visited marks in a Workspace, which can be
+    // passed in explicitly, or else a workspace of the calling thread is used. Queries are safe to run concurrently.
+    class ReachabilityIndex {
+    public:
+        // visited marks and DFS stack of queries, which can be reused across queries without resetting (epoch stamps)
+        class Workspace {
+        public:
+            explicit Workspace(const int numComponents = 0) : stamp(numComponents, 0) {}
+
+        private:
+            friend class ReachabilityIndex;
+            std::vector<uint32_t> stamp; // epoch of the query which last visited each component
+            uint32_t epoch = 0;
+            std::vector<int> stack{};
+
+            void reset(const int numComponents) {
+                if (static_cast<size_t>(numComponents) > stamp.size()) stamp.resize(numComponents, 0);
+                if (epoch == std::numeric_limits<uint32_t>::max()) {
+                    std::fill(stamp.begin(), stamp.end(), 0);
+                    epoch = 0;
+                }
+                ++epoch;
+                stack.clear();
+            }
+        };
+
+        // build index of dg with numTraversals interval labels per component (random generator seed)
+        // (for all digraph types, see GraphConcept.h)
+        template<typename DG, EnableIfGraphLike<DG> = 0>
+        explicit ReachabilityIndex(const DG& dg, const int numTraversals = 3, const uint32_t seed = 1234) :
+                k(numTraversals) {
+            if (numTraversals < 1) throw std::invalid_argument("Number of traversals must be positive");
+            const StronglyConnectedComponents scc(dg, SccAlgorithm::Pearce);
+            numComp = scc.numberOfComponents();
+            componentOf.resize(dg.V());
+            for (int v = 0; v < dg.V(); ++v) componentOf[v] = scc.id(v);
+            condense(dg);
+            label(seed);
+        }
+
+        // whether there is a directed path from u to v (every vertex reaches itself)
+        [[nodiscard]] bool reachable(const int u, const int v, Workspace& workspace) const {
+            if (!vertexValid(u) || !vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            const int from = componentOf[u];
+            const int to = componentOf[v];
+            if (from == to) return true;
+            if (from < to || !contains(from, to)) return false;
+
+            // DFS from 'from' which prunes components that cannot reach 'to'
+            workspace.reset(numComp);
+            workspace.stamp[from] = workspace.epoch;
+            workspace.stack.push_back(from);
+            while (!workspace.stack.empty()) {
+                const int c = workspace.stack.back();
+                workspace.stack.pop_back();
+                for (const int d : dag.row(c)) {
+                    if (d == to) return true;
+                    if (d < to || workspace.stamp[d] == workspace.epoch || !contains(d, to)) continue;
+                    workspace.stamp[d] = workspace.epoch;
+                    workspace.stack.push_back(d);
+                }
+            }
+            return false;
+        }
+
+        // whether there is a directed path from u to v with a workspace of the calling thread
+        // (shared by all indexes and kept until the thread ends, grown to the largest number of components queried)
+        [[nodiscard]] bool reachable(const int u, const int v) const {
+            thread_local Workspace threadWorkspace{};
+            return reachable(u, v, threadWorkspace);
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const {
+            return static_cast<int>(componentOf.size());
+        }
+
+        // number of strong components, i.e. vertices of the condensation DAG
+        [[nodiscard]] int numberOfComponents() const {
+            return numComp;
+        }
+
+        // strong component of vertex v
+        [[nodiscard]] int component(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return componentOf[v];
+        }
+
+        // bytes used by component IDs, condensation and labels
+        [[nodiscard]] size_t memoryBytes() const {
+            return componentOf.capacity() * sizeof(int) + (static_cast<size_t>(numComp) + 1) * sizeof(size_t) +
+                   dag.numEntries() * sizeof(int) + labels.capacity() * sizeof(Interval);
+        }
+
+    private:
+        struct Interval {
+            int low; // smallest postorder rank of the components reachable from a component
+            int post; // postorder rank of a component
+        };
+
+        int k; // number of interval labels per component
+        int numComp = 0;
+        std::vector<int> componentOf{}; // strong component of every vertex
+        CompressedSparseRows dag{}; // edges between different components without duplicates
+        std::vector<Interval> labels{}; // k labels of component c at c*k, ..., c*k+k-1
+
+        [[nodiscard]] bool vertexValid(const int v) const {
+            return v >= 0 && v < V();
+        }
+
+        // whether all labels of component d are contained in the ones of c (necessary for c reaching d)
+        [[nodiscard]] bool contains(const int c, const int d) const {
+            const Interval* outer = labels.data() + static_cast<size_t>(c) * k;
+            const Interval* inner = labels.data() + static_cast<size_t>(d) * k;
+            for (int i = 0; i < k; ++i) {
+                if (inner[i].low < outer[i].low || inner[i].post > outer[i].post) return false;
+            }
+            return true;
+        }
+
+        template<typename DG>
+        void condense(const DG& dg) {
+            std::vector<size_t> offsets(static_cast<size_t>(numComp) + 1, 0);
+            std::vector<int> targets{};
+            // sort vertices by component to collect the edges of each component together
+            std::vector<int> byComponent(dg.V());
+            std::vector<size_t> next(static_cast<size_t>(numComp) + 1, 0);
+            for (const int c : componentOf) ++next[c + 1];
+            for (int c = 0; c < numComp; ++c) next[c + 1] += next[c];
+            for (int v = 0; v < dg.V(); ++v) byComponent[next[componentOf[v]]++] = v;
+            std::vector<int> lastSource(numComp, -1); // for removing duplicate edges
+            size_t i = 0;
+            for (int c = 0; c < numComp; ++c) {
+                for (; i < byComponent.size() && componentOf[byComponent[i]] == c; ++i) {
+                    for (const int w : uncheckedAdj(dg, byComponent[i])) {
+                        const int d = componentOf[w];
+                        if (d != c && lastSource[d] != c) {
+                            lastSource[d] = c;
+                            targets.push_back(d);
+                        }
+                    }
+                }
+                offsets[c + 1] = targets.size();
+            }
+            dag = CompressedSparseRows(std::move(offsets), std::move(targets));
+        }
+
+        // k randomized DFS traversals of the DAG, each starting from the components without in-edges in random order
+        // and visiting the children of each component from a random position on
+        void label(const uint32_t seed) {
+            labels.assign(static_cast<size_t>(numComp) * k, Interval{0, 0});
+            std::vector<bool> hasInEdge(numComp, false);
+            for (int c = 0; c < numComp; ++c) {
+                for (const int d : dag.row(c)) hasInEdge[d] = true;
+            }
+            std::vector<int> roots{};
+            for (int c = 0; c < numComp; ++c) {
+                if (!hasInEdge[c]) roots.push_back(c);
+            }
+
+            struct Frame {
+                int c;
+                size_t start; // position of the first child to visit
+                size_t visitedChildren;
+            };
+            std::mt19937 gen(seed);
+            std::vector<bool> visited(numComp);
+            std::vector<Frame> stack{};
+            for (int i = 0; i < k; ++i) {
+                std::shuffle(roots.begin(), roots.end(), gen);
+                std::fill(visited.begin(), visited.end(), false);
+                int rank = 0;
+                const auto push = [&](const int c) {
+                    visited[c] = true;
+                    const size_t degree = dag.row(c).size();
+                    const size_t start = degree > 1 ? std::uniform_int_distribution<size_t>(0, degree - 1)(gen) : 0;
+                    stack.push_back({c, start, 0});
+                    labels[static_cast<size_t>(c) * k + i].low = std::numeric_limits<int>::max();
+                };
+                for (const int root : roots) {
+                    push(root);
+                    while (!stack.empty()) {
+                        Frame& frame = stack.back();
+                        const auto children = dag.row(frame.c);
+                        Interval& interval = labels[static_cast<size_t>(frame.c) * k + i];
+                        if (frame.visitedChildren < children.size()) {
+                            const int d = children[(frame.start + frame.visitedChildren++) % children.size()];
+                            if (!visited[d]) {
+                                push(d); // frame is invalid now
+                            } else {
+                                interval.low = std::min(interval.low, labels[static_cast<size_t>(d) * k + i].low);
+                            }
+                            continue;
+                        }
+                        interval.post = ++rank;
+                        interval.low = std::min(interval.low, interval.post);
+                        const int c = frame.c;
+                        stack.pop_back();
+                        if (!stack.empty()) {
+                            Interval& parent = labels[static_cast<size_t>(stack.back().c) * k + i];
+                            parent.low = std::min(parent.low, labels[static_cast<size_t>(c) * k + i].low);
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+} // namespace digraph
+
+#endif //DIGRAPHS_CPP_REACHABILITYINDEX_H
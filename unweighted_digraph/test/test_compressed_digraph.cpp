@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include "CompressedDigraph.h"
+
+// digraph source of tinyDG.txt
+static const char* tinyDGCompressed = R"(13
+22
+0 5 0 1 2 0 2 3 3 2 3 5 4 2 4 3 5 4 6 0 6 4
+6 8 6 9 7 6 7 9 8 6 9 10 9 11 10 12 11 4 11 12 12 9
+)";
+
+TEST(compressed_digraph, same_as_adjacency_list) { // NOLINT
+    std::istringstream iss(tinyDGCompressed);
+    const digraph::AdjacencyListDigraph adjListDigraph(iss);
+    const digraph::CompressedDigraph compressed(adjListDigraph);
+    EXPECT_EQ(compressed.V(), 13);
+    EXPECT_EQ(compressed.E(), 22);
+    for (int v = 0; v < compressed.V(); ++v) {
+        auto expected = adjListDigraph.adj(v).toVector();
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(compressed.adj(v).toVector(), expected);
+        EXPECT_EQ(compressed.degree(v), static_cast<int>(expected.size()));
+    }
+    EXPECT_TRUE(compressed.hasEdge(0, 5));
+    EXPECT_FALSE(compressed.hasEdge(5, 0));
+    EXPECT_ANY_THROW(static_cast<void>(compressed.adj(13)));
+
+    std::istringstream iss2(tinyDGCompressed);
+    EXPECT_EQ(digraph::CompressedDigraph(iss2).toString(), compressed.toString());
+
+    const digraph::StronglyConnectedComponents scc(compressed);
+    EXPECT_EQ(scc.numberOfComponents(), 5);
+    EXPECT_EQ(scc.components(), digraph::StronglyConnectedComponents(adjListDigraph).components());
+}
@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+#include <memory>
+#include "CsrDigraph.h"
+
+// digraph source of tinyDG.txt
+static const char* tinyDGCsr = R"(13
+22
+0 5 0 1 2 0 2 3 3 2 3 5 4 2 4 3 5 4 6 0 6 4
+6 8 6 9 7 6 7 9 8 6 9 10 9 11 10 12 11 4 11 12 12 9
+)";
+
+TEST(csr_digraph, same_as_adjacency_list) { // NOLINT
+    std::istringstream iss1(tinyDGCsr);
+    const digraph::AdjacencyListDigraph adjListDigraph(iss1);
+    const digraph::CsrDigraph fromAdjList(adjListDigraph);
+    std::istringstream iss2(tinyDGCsr);
+    const digraph::CsrDigraph fromStream(iss2);
+
+    for (const digraph::Digraph* pDigraph : {static_cast<const digraph::Digraph*>(&fromAdjList),
+                                             static_cast<const digraph::Digraph*>(&fromStream)}) {
+        EXPECT_EQ(pDigraph->V(), 13);
+        EXPECT_EQ(pDigraph->E(), 22);
+        EXPECT_EQ(pDigraph->toString(), adjListDigraph.toString());
+        EXPECT_ANY_THROW(pDigraph->adj(-1));
+    }
+
+    // reversed digraphs have the same adjacencies (in the same order, as both loop through vertices in ascending order)
+    const auto pReverse = fromAdjList.reverse();
+    const auto pReverseAdjList = adjListDigraph.reverse();
+    EXPECT_EQ(pReverse->E(), 22);
+    EXPECT_EQ(pReverse->toString(), pReverseAdjList->toString());
+}
+
+TEST(csr_digraph, algorithms) { // NOLINT
+    std::istringstream iss(tinyDGCsr);
+    const digraph::AdjacencyListDigraph adjListDigraph(iss);
+    digraph::CsrDigraph csrDigraph(adjListDigraph);
+
+    const digraph::StronglyConnectedComponents scc(csrDigraph);
+    EXPECT_EQ(scc.numberOfComponents(), 5);
+    EXPECT_EQ(scc.components(), digraph::StronglyConnectedComponents(adjListDigraph).components());
+    const digraph::Digraph& dg = adjListDigraph; // virtual interface
+    EXPECT_EQ(scc.components(), digraph::StronglyConnectedComponents(dg).components());
+    EXPECT_TRUE(digraph::containsCycle(csrDigraph).has_value());
+    EXPECT_THROW(csrDigraph.addEdge(0, 1), std::logic_error);
+}
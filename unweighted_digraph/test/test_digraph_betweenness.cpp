@@ -0,0 +1,25 @@
+#include "gtest/gtest.h"
+#include "DigraphBetweenness.h"
+#include "CsrDigraph.h"
+
+TEST(digraph_betweenness, small) { // NOLINT
+    // 0->1->2 and 0->3->2: the two shortest 0-2 paths share the pair equally, 2->4 continues both
+    digraph::AdjacencyListDigraph dg(5);
+    dg.addEdge(0, 1);
+    dg.addEdge(1, 2);
+    dg.addEdge(0, 3);
+    dg.addEdge(3, 2);
+    dg.addEdge(2, 4);
+    const auto c = digraph::betweennessCentrality(dg);
+    // 1 and 3: half of (0,2) and (0,4); 2: (0,4), (1,4), (3,4)
+    EXPECT_EQ(c, (std::vector<double>{0, 1, 3, 1, 0}));
+    EXPECT_EQ(digraph::betweennessCentrality(digraph::CsrDigraph(dg), 2), c);
+
+    // in a directed cycle, every vertex is on the only path between one pair
+    digraph::AdjacencyListDigraph cycle(3);
+    cycle.addEdge(0, 1);
+    cycle.addEdge(1, 2);
+    cycle.addEdge(2, 0);
+    EXPECT_EQ(digraph::betweennessCentrality(cycle), (std::vector<double>{1, 1, 1}));
+    EXPECT_EQ(digraph::approximateBetweennessCentrality(cycle, 3), (std::vector<double>{1, 1, 1}));
+}
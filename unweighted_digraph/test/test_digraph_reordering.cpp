@@ -0,0 +1,35 @@
+#include "gtest/gtest.h"
+#include "DigraphReordering.h"
+
+// digraph source of tinyDG.txt
+static const char* tinyDGReordering = R"(13
+22
+0 5 0 1 2 0 2 3 3 2 3 5 4 2 4 3 5 4 6 0 6 4
+6 8 6 9 7 6 7 9 8 6 9 10 9 11 10 12 11 4 11 12 12 9
+)";
+
+TEST(digraph_reordering, relabel) { // NOLINT
+    std::istringstream iss(tinyDGReordering);
+    const digraph::AdjacencyListDigraph dg(iss);
+    const auto permutation = digraph::computeVertexOrder(dg, VertexOrder::ReverseCuthillMcKee);
+    const auto relabeled = digraph::relabel(dg, permutation);
+    EXPECT_EQ(relabeled.E(), 22);
+    for (int v = 0; v < dg.V(); ++v) {
+        for (const int w : dg.adj(v)) {
+            const auto adjacent = relabeled.adj(permutation.toNew(v));
+            EXPECT_NE(std::find(adjacent.begin(), adjacent.end(), permutation.toNew(w)), adjacent.end());
+        }
+    }
+
+    // components translated back to original IDs are the same
+    auto components = digraph::StronglyConnectedComponents(relabeled).components();
+    for (auto& component : components) {
+        component = permutation.toOld(component);
+        std::sort(component.begin(), component.end());
+    }
+    auto expected = digraph::StronglyConnectedComponents(dg).components();
+    for (auto& component : expected) std::sort(component.begin(), component.end());
+    std::sort(components.begin(), components.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(components, expected);
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include <random>
+#include "DigraphShortestPath.h"
+
+TEST(digraph_shortest_path, small_digraph) { // NOLINT
+    digraph::AdjacencyListDigraph dg(5);
+    dg.addEdge(0, 1);
+    dg.addEdge(1, 2);
+    dg.addEdge(2, 3);
+    dg.addEdge(3, 0);
+    dg.addEdge(0, 3);
+
+    EXPECT_EQ(digraph::shortestPath(dg, 0, 3), (std::vector<int>{0, 3}));
+    EXPECT_EQ(digraph::shortestPath(dg, 3, 2), (std::vector<int>{3, 0, 1, 2}));
+    EXPECT_TRUE(digraph::shortestPath(dg, 0, 4).empty());
+    EXPECT_TRUE(digraph::shortestPath(dg, 4, 0).empty());
+    EXPECT_ANY_THROW(digraph::shortestPath(dg, 0, 5));
+}
+
+TEST(digraph_shortest_path, random_digraph) { // NOLINT
+    const int numV = 2000;
+    digraph::AdjacencyListDigraph dg(numV);
+    std::mt19937 gen(7); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    for (int i = 0; i < 3 * numV; ++i) {
+        dg.addEdge(vertexDist(gen), vertexDist(gen));
+    }
+    const auto pReverse = dg.reverse();
+    BidirectionalBfsWorkspace workspace{};
+    for (int s = 0; s < 50; ++s) {
+        const int t = vertexDist(gen);
+        // compare length with a full BFS from s
+        std::vector<int> dist(numV, -1);
+        std::vector<int> queue{s};
+        dist[s] = 0;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (const int w : dg.adj(queue[head])) {
+                if (dist[w] == -1) {
+                    dist[w] = dist[queue[head]] + 1;
+                    queue.push_back(w);
+                }
+            }
+        }
+        const auto path = digraph::shortestPath(dg, *pReverse, s, t, workspace);
+        EXPECT_EQ(static_cast<int>(path.size()) - 1, dist[t]);
+        for (size_t i = 0; i + 1 < path.size(); ++i) {
+            const auto adjacent = dg.adj(path[i]);
+            EXPECT_NE(std::find(adjacent.begin(), adjacent.end(), path[i + 1]), adjacent.end());
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <algorithm>
+#include "CsrDigraph.h"
+#include "DigraphShortestPath.h"
+#include "Parallel.h"
+
+TEST(in_edge_index, in_adjacencies) { // NOLINT
+    // 0->1, 0->2, 2->1, 3->1
+    digraph::AdjacencyListDigraph dg(4);
+    dg.addEdge(0, 1);
+    dg.addEdge(0, 2);
+    dg.addEdge(2, 1);
+    dg.addEdge(3, 1);
+    const auto in1 = dg.inAdj(1);
+    EXPECT_EQ(std::vector<int>(in1.begin(), in1.end()), (std::vector<int>{0, 2, 3}));
+    EXPECT_EQ(dg.inAdj(0).size(), 0);
+    EXPECT_THROW((void) dg.inAdj(4), std::invalid_argument);
+
+    // the index is built once and shared until the next addEdge
+    const auto index = dg.inEdges();
+    EXPECT_EQ(dg.inEdges(), index);
+    dg.addEdge(1, 0);
+    EXPECT_NE(dg.inEdges(), index);
+    EXPECT_EQ(dg.inAdj(0).size(), 1);
+    EXPECT_EQ(index->row(0).size(), 0); // old index is unchanged
+
+    const digraph::CsrDigraph csr(dg);
+    EXPECT_EQ(csr.inEdges()->entries(), dg.inEdges()->entries());
+    EXPECT_EQ(csr.inEdges()->rowOffsets(), dg.inEdges()->rowOffsets());
+}
+
+TEST(in_edge_index, reverse_view) { // NOLINT
+    digraph::AdjacencyListDigraph dg(3);
+    dg.addEdge(0, 1);
+    dg.addEdge(0, 2);
+    dg.addEdge(1, 2);
+    const auto reverse = dg.reverse();
+    EXPECT_EQ(reverse->V(), 3);
+    EXPECT_EQ(reverse->E(), 3);
+    EXPECT_EQ(reverse->toString(), "[Digraph with 3 vertices and 3 edges]\n1->0\n2->0\n2->1\n");
+    EXPECT_EQ(reverse->reverse()->toString(), dg.toString());
+    EXPECT_EQ(reverse->inAdj(0).size(), 2);
+    EXPECT_THROW(reverse->addEdge(0, 1), std::logic_error);
+    EXPECT_THROW((void) reverse->adj(3), std::invalid_argument);
+
+    // the view keeps its index when the digraph changes
+    dg.addEdge(2, 0);
+    EXPECT_EQ(reverse->E(), 3);
+    EXPECT_EQ(dg.reverse()->E(), 4);
+}
+
+TEST(in_edge_index, algorithms_on_random_digraph) { // NOLINT
+    std::mt19937 gen(25); // NOLINT
+    constexpr int V = 500;
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    digraph::AdjacencyListDigraph dg(V);
+    for (int i = 0; i < 1500; ++i) dg.addEdge(vertexDist(gen), vertexDist(gen));
+
+    // in-adjacencies match a reverse built edge by edge
+    digraph::AdjacencyListDigraph copiedReverse(V);
+    for (int v = 0; v < V; ++v) {
+        for (const int w : dg.adj(v)) copiedReverse.addEdge(w, v);
+    }
+    EXPECT_EQ(dg.reverse()->toString(), copiedReverse.toString());
+
+    const digraph::Digraph& iface = dg;
+    const digraph::StronglyConnectedComponents viaInterface(iface);
+    const digraph::StronglyConnectedComponents viaTemplate(dg, digraph::SccAlgorithm::Pearce);
+    auto a = viaInterface.components();
+    auto b = viaTemplate.components();
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    EXPECT_EQ(a, b);
+
+    BidirectionalBfsWorkspace workspace{};
+    for (int i = 0; i < 50; ++i) {
+        const int s = vertexDist(gen);
+        const int t = vertexDist(gen);
+        EXPECT_EQ(digraph::shortestPath(dg, s, t, workspace).size(),
+                  digraph::shortestPath(dg, copiedReverse, s, t, workspace).size());
+    }
+}
+
+TEST(in_edge_index, concurrent_first_calls) { // NOLINT
+    std::mt19937 gen(5); // NOLINT
+    constexpr int V = 2000;
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    for (int round = 0; round < 20; ++round) {
+        digraph::AdjacencyListDigraph dg(V);
+        for (int i = 0; i < 4 * V; ++i) dg.addEdge(vertexDist(gen), vertexDist(gen));
+
+        // threads racing to build the index all receive the stored one, so views from inAdj stay valid
+        std::vector<std::shared_ptr<const CompressedSparseRows>> indexOfThread(4);
+        runOnThreads(4, [&](const unsigned threadId) { indexOfThread[threadId] = dg.inEdges(); });
+        for (const auto& index : indexOfThread) EXPECT_EQ(index, dg.inEdges());
+    }
+}
@@ -0,0 +1,77 @@
+#include <random>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "IncrementalTopologicalOrder.h"
+
+namespace {
+    // whether order is a permutation of the vertices of dg in which all edges point forward
+    bool isTopologicalOrder(const digraph::Digraph& dg, const std::vector<int>& order) {
+        if (static_cast<int>(order.size()) != dg.V()) return false;
+        std::vector<int> position(dg.V(), -1);
+        for (int i = 0; i < dg.V(); ++i) {
+            if (order[i] < 0 || order[i] >= dg.V() || position[order[i]] != -1) return false;
+            position[order[i]] = i;
+        }
+        for (int v = 0; v < dg.V(); ++v) {
+            for (const int w : dg.adj(v)) {
+                if (position[v] >= position[w]) return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(incremental_topological_order, small) { // NOLINT
+    digraph::IncrementalTopologicalOrderDigraph dg(5);
+    EXPECT_EQ(dg.topologicalOrder(), (std::vector<int>{0, 1, 2, 3, 4}));
+    dg.addEdge(3, 1); // 1 and 3 swap places
+    EXPECT_EQ(dg.topologicalOrder(), (std::vector<int>{0, 3, 2, 1, 4}));
+    dg.addEdge(1, 0); // 3 and 1 move before 0, the unaffected 2 and 4 stay
+    EXPECT_EQ(dg.topologicalOrder(), (std::vector<int>{3, 1, 2, 0, 4}));
+    EXPECT_EQ(dg.position(0), 3);
+    dg.addEdge(2, 4); // already in order
+
+    EXPECT_FALSE(dg.tryAddEdge(0, 3)); // 3->1->0->3
+    EXPECT_THROW(dg.addEdge(0, 0), std::invalid_argument);
+    EXPECT_THROW(dg.addEdge(0, 5), std::invalid_argument);
+    EXPECT_EQ(dg.E(), 3);
+    EXPECT_EQ(dg.topologicalOrder(), (std::vector<int>{3, 1, 2, 0, 4}));
+    EXPECT_TRUE(dg.tryAddEdge(3, 0)); // parallel to 3->1->0
+    EXPECT_TRUE(isTopologicalOrder(dg, dg.topologicalOrder()));
+
+    std::stringstream ss("3\n2\n0 1\n1 2\n");
+    const digraph::IncrementalTopologicalOrderDigraph fromStream(ss);
+    EXPECT_EQ(fromStream.topologicalOrder(), (std::vector<int>{0, 1, 2}));
+    std::stringstream withCycle("2\n2\n0 1\n1 0\n");
+    EXPECT_THROW(digraph::IncrementalTopologicalOrderDigraph{withCycle}, std::invalid_argument);
+}
+
+TEST(incremental_topological_order, random_insertions) { // NOLINT
+    std::mt19937 gen(24); // NOLINT
+    constexpr int V = 300;
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    digraph::IncrementalTopologicalOrderDigraph dg(V);
+    digraph::AdjacencyListDigraph reference(V);
+    int rejected = 0;
+    for (int i = 0; i < 3000; ++i) {
+        const int v = vertexDist(gen);
+        const int w = vertexDist(gen);
+        // an edge is rejected exactly if it would create a cycle in the reference digraph
+        reference.addEdge(v, w);
+        const bool createsCycle = digraph::containsCycle(reference).has_value();
+        ASSERT_EQ(dg.tryAddEdge(v, w), !createsCycle);
+        if (createsCycle) {
+            ++rejected;
+            reference = digraph::AdjacencyListDigraph(V);
+            for (int from = 0; from < V; ++from) {
+                for (const int to : dg.adj(from)) reference.addEdge(from, to);
+            }
+        }
+        if (i % 100 == 0) {
+            ASSERT_TRUE(isTopologicalOrder(dg, dg.topologicalOrder()));
+        }
+    }
+    EXPECT_GT(rejected, 0);
+    EXPECT_TRUE(isTopologicalOrder(dg, dg.topologicalOrder()));
+    for (int v = 0; v < V; ++v) EXPECT_EQ(dg.topologicalOrder()[dg.position(v)], v);
+}
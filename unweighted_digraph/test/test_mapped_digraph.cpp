@@ -0,0 +1,39 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include "MappedDigraph.h"
+
+// digraph source of tinyDG.txt
+static const char* tinyDGMapped = R"(13
+22
+0 5 0 1 2 0 2 3 3 2 3 5 4 2 4 3 5 4 6 0 6 4
+6 8 6 9 7 6 7 9 8 6 9 10 9 11 10 12 11 4 11 12 12 9
+)";
+
+TEST(mapped_digraph, same_as_original) { // NOLINT
+    std::istringstream iss(tinyDGMapped);
+    const digraph::AdjacencyListDigraph original(iss);
+    const std::string path = "test_mapped_digraph_tmp.bin";
+    digraph::writeSnapshot(original, path);
+    {
+        const digraph::MappedDigraph mapped(path);
+        mapped.validate();
+        EXPECT_EQ(mapped.V(), 13);
+        EXPECT_EQ(mapped.E(), 22);
+        EXPECT_EQ(mapped.toString(), original.toString());
+        EXPECT_EQ(mapped.reverse()->toString(), original.reverse()->toString());
+        EXPECT_ANY_THROW(static_cast<void>(mapped.adj(13)));
+
+        // algorithms work on the mapped digraph directly
+        EXPECT_EQ(digraph::StronglyConnectedComponents(mapped).components(),
+                  digraph::StronglyConnectedComponents(original).components());
+
+        // copies share the mapping
+        const digraph::MappedDigraph copy = mapped;
+        EXPECT_EQ(copy.adj(0).data(), mapped.adj(0).data());
+
+        // modifiable copy from the snapshot
+        const digraph::AdjacencyListDigraph modifiable(SnapshotFile(path, SnapshotType::Digraph).toEdgeList());
+        EXPECT_EQ(modifiable.toString(), original.toString());
+    }
+    std::remove(path.c_str());
+}
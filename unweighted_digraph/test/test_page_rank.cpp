@@ -0,0 +1,107 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "PageRank.h"
+#include "CsrDigraph.h"
+
+namespace {
+    // PageRank with dense power iteration (push-based, no convergence check) for comparison
+    std::vector<double> pageRankDense(const digraph::Digraph& dg, const std::vector<double>& teleport,
+                                      const double damping, const int iterations) {
+        const int V = dg.V();
+        std::vector<double> rank = teleport;
+        for (int it = 0; it < iterations; ++it) {
+            std::vector<double> next(V, 0.0);
+            for (int v = 0; v < V; ++v) {
+                const auto adj = dg.adj(v);
+                for (int w = 0; w < V; ++w) {
+                    const double share = adj.size() == 0 ? teleport[w] :
+                                         static_cast<double>(std::count(adj.begin(), adj.end(), w)) /
+                                         static_cast<double>(adj.size());
+                    next[w] += damping * rank[v] * share;
+                }
+            }
+            for (int w = 0; w < V; ++w) next[w] += (1.0 - damping) * teleport[w];
+            rank = next;
+        }
+        return rank;
+    }
+}
+
+TEST(page_rank, cycle_and_dangling) { // NOLINT
+    // all vertices of a directed cycle have the same rank
+    digraph::AdjacencyListDigraph cycle(3);
+    cycle.addEdge(0, 1);
+    cycle.addEdge(1, 2);
+    cycle.addEdge(2, 0);
+    const digraph::PageRank pr(cycle);
+    EXPECT_TRUE(pr.converged());
+    for (int v = 0; v < 3; ++v) EXPECT_NEAR(pr.rank(v), 1.0 / 3, 1e-12);
+
+    // 0->1, 0->2, 1->2, 2 is dangling
+    digraph::AdjacencyListDigraph dg(3);
+    dg.addEdge(0, 1);
+    dg.addEdge(0, 2);
+    dg.addEdge(1, 2);
+    const digraph::PageRank ranks(dg, 0.85, 1e-12, 1000);
+    EXPECT_TRUE(ranks.converged());
+    const auto expected = pageRankDense(dg, std::vector<double>(3, 1.0 / 3), 0.85, 200);
+    for (int v = 0; v < 3; ++v) EXPECT_NEAR(ranks.rank(v), expected[v], 1e-10);
+    EXPECT_EQ(ranks.top(2), (std::vector<int>{2, 1}));
+    EXPECT_EQ(ranks.top(5).size(), 3);
+    EXPECT_THROW((void) ranks.rank(3), std::invalid_argument);
+}
+
+TEST(page_rank, random_digraph) { // NOLINT
+    constexpr int V = 300;
+    std::mt19937 gen(7); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    digraph::AdjacencyListDigraph dg(V);
+    for (int i = 0; i < 4 * V; ++i) dg.addEdge(vertexDist(gen), vertexDist(gen));
+
+    const digraph::PageRank pr(dg, 0.85, 1e-12, 1000, 1);
+    EXPECT_TRUE(pr.converged());
+    const auto expected = pageRankDense(dg, std::vector<double>(V, 1.0 / V), 0.85, 300);
+    double sum = 0.0;
+    for (int v = 0; v < V; ++v) {
+        EXPECT_NEAR(pr.rank(v), expected[v], 1e-10);
+        sum += pr.rank(v);
+    }
+    EXPECT_NEAR(sum, 1.0, 1e-9);
+
+    // same ranks on several threads and through the interface
+    const digraph::PageRank parallel(digraph::CsrDigraph(dg), 0.85, 1e-12, 1000, 4);
+    const digraph::Digraph& base = dg;
+    const digraph::PageRank throughInterface(base, 0.85, 1e-12, 1000, 2);
+    for (int v = 0; v < V; ++v) {
+        EXPECT_NEAR(parallel.rank(v), pr.rank(v), 1e-12);
+        EXPECT_NEAR(throughInterface.rank(v), pr.rank(v), 1e-12);
+    }
+
+    // without iterations, the ranks are the teleport probabilities
+    const digraph::PageRank none(dg, 0.85, 1e-9, 0);
+    EXPECT_FALSE(none.converged());
+    EXPECT_EQ(none.iterations(), 0);
+    EXPECT_DOUBLE_EQ(none.rank(0), 1.0 / V);
+}
+
+TEST(page_rank, personalized) { // NOLINT
+    // 0->1->2->3 and 3->0, 4->0: jumps only go to 4, which nothing links to
+    digraph::AdjacencyListDigraph dg(5);
+    dg.addEdge(0, 1);
+    dg.addEdge(1, 2);
+    dg.addEdge(2, 3);
+    dg.addEdge(3, 0);
+    dg.addEdge(4, 0);
+    const std::vector<double> personalization{0, 0, 0, 0, 2};
+    const digraph::PageRank pr(dg, personalization, 0.85, 1e-12, 1000);
+    EXPECT_TRUE(pr.converged());
+    const auto expected = pageRankDense(dg, {0, 0, 0, 0, 1}, 0.85, 400);
+    for (int v = 0; v < 5; ++v) EXPECT_NEAR(pr.rank(v), expected[v], 1e-10);
+    EXPECT_NEAR(pr.rank(4), 0.15, 1e-12);
+    EXPECT_EQ(pr.top(1), std::vector<int>{0});
+
+    EXPECT_THROW(digraph::PageRank(dg, std::vector<double>(5, 0.0)), std::invalid_argument);
+    EXPECT_THROW(digraph::PageRank(dg, std::vector<double>(4, 1.0)), std::invalid_argument);
+    EXPECT_THROW(digraph::PageRank(dg, std::vector<double>{1, 1, -1, 1, 1}), std::invalid_argument);
+    EXPECT_THROW(digraph::PageRank(dg, 1.0), std::invalid_argument);
+}
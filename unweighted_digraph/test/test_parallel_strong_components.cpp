@@ -0,0 +1,58 @@
+#include <random>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "ParallelStronglyConnectedComponents.h"
+#include "CsrDigraph.h"
+#include "CompressedDigraph.h"
+
+namespace {
+    std::vector<std::vector<int>> sortedComponents(const digraph::StronglyConnectedComponents& scc) {
+        auto result = scc.components();
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+TEST(parallel_strong_components, like_serial) { // NOLINT
+    std::mt19937 gen(11); // NOLINT
+    for (const int V : {1, 10, 200, 3000}) {
+        std::uniform_int_distribution<int> vertexDist(0, V - 1);
+        for (const double density : {0.5, 1.0, 1.5, 4.0}) {
+            digraph::AdjacencyListDigraph dg(V);
+            for (int i = 0; i < static_cast<int>(density * V); ++i) dg.addEdge(vertexDist(gen), vertexDist(gen));
+            const auto expected = sortedComponents(digraph::StronglyConnectedComponents(dg));
+            for (const unsigned threads : {1u, 4u}) {
+                const auto scc = digraph::stronglyConnectedComponentsParallel(dg, threads);
+                EXPECT_EQ(sortedComponents(scc), expected);
+                // numbered in order of the smallest vertex of each component
+                EXPECT_EQ(scc.components(), expected);
+            }
+            EXPECT_EQ(digraph::stronglyConnectedComponentsParallel(digraph::CsrDigraph(dg), 2).components(), expected);
+            EXPECT_EQ(digraph::stronglyConnectedComponentsParallel(digraph::CompressedDigraph(dg), 2).components(),
+                      expected);
+        }
+    }
+}
+
+TEST(parallel_strong_components, structured) { // NOLINT
+    // chain of 100 cycles of length 50 with a few chords, connected by single edges, and a tail of trivial components
+    constexpr int numCycles = 100, cycleLength = 50, tail = 1000;
+    digraph::AdjacencyListDigraph dg(numCycles * cycleLength + tail);
+    for (int c = 0; c < numCycles; ++c) {
+        const int first = c * cycleLength;
+        for (int i = 0; i < cycleLength; ++i) dg.addEdge(first + i, first + (i + 1) % cycleLength);
+        dg.addEdge(first + 3, first + 20);
+        if (c + 1 < numCycles) dg.addEdge(first + 7, first + cycleLength + 11);
+    }
+    for (int v = numCycles * cycleLength; v + 1 < dg.V(); ++v) dg.addEdge(v + 1, v);
+    dg.addEdge(numCycles * cycleLength, 0);
+
+    const auto scc = digraph::stronglyConnectedComponentsParallel(dg, 3);
+    EXPECT_EQ(scc.numberOfComponents(), numCycles + tail);
+    EXPECT_EQ(sortedComponents(scc), sortedComponents(digraph::StronglyConnectedComponents(dg)));
+    EXPECT_TRUE(scc.stronglyConnected(0, cycleLength - 1));
+    EXPECT_FALSE(scc.stronglyConnected(0, cycleLength));
+
+    EXPECT_EQ(digraph::stronglyConnectedComponentsParallel(digraph::AdjacencyListDigraph(0)).numberOfComponents(), 0);
+    EXPECT_THROW((void) digraph::StronglyConnectedComponents::fromLabels({0, 2}), std::invalid_argument);
+}
@@ -0,0 +1,117 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "ReachabilityIndex.h"
+#include "CsrDigraph.h"
+#include "CompressedDigraph.h"
+#include "Parallel.h"
+
+namespace {
+    // vertices reachable from s with BFS
+    std::vector<bool> reachableFrom(const digraph::Digraph& dg, const int s) {
+        std::vector<bool> reached(dg.V(), false);
+        std::vector<int> queue{s};
+        reached[s] = true;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (const int w : dg.adj(queue[head])) {
+                if (!reached[w]) {
+                    reached[w] = true;
+                    queue.push_back(w);
+                }
+            }
+        }
+        return reached;
+    }
+}
+
+TEST(reachability_index, small) { // NOLINT
+    // 0<->1 -> 2 -> 3, 4 -> 2, 5 isolated
+    digraph::AdjacencyListDigraph dg(6);
+    dg.addEdge(0, 1);
+    dg.addEdge(1, 0);
+    dg.addEdge(1, 2);
+    dg.addEdge(2, 3);
+    dg.addEdge(4, 2);
+    dg.addEdge(1, 2);
+    const digraph::ReachabilityIndex index(dg);
+    EXPECT_EQ(index.V(), 6);
+    EXPECT_EQ(index.numberOfComponents(), 5);
+    EXPECT_EQ(index.component(0), index.component(1));
+    EXPECT_TRUE(index.reachable(1, 0));
+    EXPECT_TRUE(index.reachable(0, 3));
+    EXPECT_TRUE(index.reachable(4, 3));
+    EXPECT_TRUE(index.reachable(5, 5));
+    EXPECT_FALSE(index.reachable(3, 0));
+    EXPECT_FALSE(index.reachable(4, 0));
+    EXPECT_FALSE(index.reachable(0, 4));
+    EXPECT_FALSE(index.reachable(0, 5));
+    EXPECT_THROW((void) index.reachable(0, 6), std::invalid_argument);
+    EXPECT_THROW(digraph::ReachabilityIndex(dg, 0), std::invalid_argument);
+}
+
+TEST(reachability_index, like_bfs) { // NOLINT
+    std::mt19937 gen(29); // NOLINT
+    for (const int V : {1, 30, 300}) {
+        std::uniform_int_distribution<int> vertexDist(0, V - 1);
+        for (const double density : {0.7, 1.2, 3.0}) {
+            digraph::AdjacencyListDigraph dg(V);
+            for (int i = 0; i < static_cast<int>(density * V); ++i) {
+                const int a = vertexDist(gen), b = vertexDist(gen);
+                // mostly edges to larger IDs, so that there are many components and long paths
+                if (gen() % 8 == 0) {
+                    dg.addEdge(a, b);
+                } else {
+                    dg.addEdge(std::min(a, b), std::max(a, b));
+                }
+            }
+            const digraph::ReachabilityIndex index(dg);
+            const digraph::ReachabilityIndex csrIndex(digraph::CsrDigraph(dg), 1);
+            const digraph::ReachabilityIndex compressedIndex(digraph::CompressedDigraph(dg), 5, 99);
+            digraph::ReachabilityIndex::Workspace workspace{};
+            for (int u = 0; u < V; ++u) {
+                const auto expected = reachableFrom(dg, u);
+                for (int v = 0; v < V; ++v) {
+                    ASSERT_EQ(index.reachable(u, v), expected[v]) << u << " " << v;
+                    ASSERT_EQ(csrIndex.reachable(u, v, workspace), expected[v]) << u << " " << v;
+                    ASSERT_EQ(compressedIndex.reachable(u, v), expected[v]) << u << " " << v;
+                }
+            }
+        }
+    }
+}
+
+TEST(reachability_index, deep) { // NOLINT
+    // long path with a shortcut: DFS traversals and queries must not recurse
+    constexpr int V = 1'000'000;
+    digraph::AdjacencyListDigraph dg(V);
+    for (int v = 0; v + 1 < V; ++v) dg.addEdge(v, v + 1);
+    dg.addEdge(10, V / 2);
+    const digraph::ReachabilityIndex index(dg, 2);
+    EXPECT_EQ(index.numberOfComponents(), V);
+    EXPECT_TRUE(index.reachable(0, V - 1));
+    EXPECT_FALSE(index.reachable(V - 1, 0));
+    EXPECT_TRUE(index.reachable(10, V / 2 + 1));
+    EXPECT_FALSE(index.reachable(V / 2, 11));
+}
+
+TEST(reachability_index, concurrent_queries) { // NOLINT
+    std::mt19937 gen(31); // NOLINT
+    constexpr int V = 400;
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    digraph::AdjacencyListDigraph dg(V);
+    for (int i = 0; i < 600; ++i) {
+        const int a = vertexDist(gen), b = vertexDist(gen);
+        dg.addEdge(std::min(a, b), std::max(a, b));
+    }
+    const digraph::ReachabilityIndex index(dg);
+    std::vector<std::vector<bool>> expected{};
+    for (int u = 0; u < V; ++u) expected.push_back(reachableFrom(dg, u));
+
+    // every thread queries all pairs with its own thread-local workspace
+    std::vector<int> mismatches(4, 0);
+    runOnThreads(4, [&](const unsigned threadId) {
+        for (int u = 0; u < V; ++u) {
+            for (int v = 0; v < V; ++v) mismatches[threadId] += index.reachable(u, v) != expected[u][v] ? 1 : 0;
+        }
+    });
+    EXPECT_EQ(mismatches, (std::vector<int>(4, 0)));
+}
@@ -0,0 +1,90 @@
+#include <random>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "Digraph.h"
+#include "CsrDigraph.h"
+#include "CompressedDigraph.h"
+
+namespace {
+    // components as sorted lists of sorted vertices (independent of the component IDs)
+    std::vector<std::vector<int>> sortedComponents(const digraph::StronglyConnectedComponents& scc) {
+        auto result = scc.components();
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // whether the component IDs are in reverse topological order of the condensation
+    bool reverseTopological(const digraph::Digraph& dg, const digraph::StronglyConnectedComponents& scc) {
+        for (int v = 0; v < dg.V(); ++v) {
+            for (const int w : dg.adj(v)) {
+                if (scc.id(v) < scc.id(w)) return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(strong_components, pearce_like_kosaraju_sharir) { // NOLINT
+    std::mt19937 gen(3); // NOLINT
+    for (const int V : {1, 5, 40, 500}) {
+        std::uniform_int_distribution<int> vertexDist(0, V - 1);
+        for (const double density : {0.5, 1.0, 2.0}) {
+            digraph::AdjacencyListDigraph dg(V);
+            for (int i = 0; i < static_cast<int>(density * V); ++i) dg.addEdge(vertexDist(gen), vertexDist(gen));
+            const digraph::StronglyConnectedComponents kosaraju(dg);
+            const digraph::StronglyConnectedComponents pearce(dg, digraph::SccAlgorithm::Pearce);
+            EXPECT_EQ(pearce.numberOfComponents(), kosaraju.numberOfComponents());
+            EXPECT_EQ(sortedComponents(pearce), sortedComponents(kosaraju));
+            EXPECT_TRUE(reverseTopological(dg, kosaraju));
+            EXPECT_TRUE(reverseTopological(dg, pearce));
+
+            const digraph::CsrDigraph csr(dg);
+            const digraph::CompressedDigraph compressed(dg);
+            EXPECT_EQ(digraph::StronglyConnectedComponents(csr, digraph::SccAlgorithm::Pearce).components(),
+                      pearce.components());
+            // sorted adjacencies change the DFS order and possibly the IDs
+            EXPECT_EQ(sortedComponents(digraph::StronglyConnectedComponents(compressed, digraph::SccAlgorithm::Pearce)),
+                      sortedComponents(pearce));
+        }
+    }
+}
+
+TEST(strong_components, pearce_small) { // NOLINT
+    // 0<->1 -> 2 -> 3<->4, 3->3, 5 isolated
+    digraph::AdjacencyListDigraph dg(6);
+    dg.addEdge(0, 1);
+    dg.addEdge(1, 0);
+    dg.addEdge(1, 2);
+    dg.addEdge(2, 3);
+    dg.addEdge(3, 4);
+    dg.addEdge(4, 3);
+    dg.addEdge(3, 3);
+    const digraph::StronglyConnectedComponents scc(dg, digraph::SccAlgorithm::Pearce);
+    EXPECT_EQ(scc.numberOfComponents(), 4);
+    EXPECT_TRUE(scc.stronglyConnected(0, 1));
+    EXPECT_TRUE(scc.stronglyConnected(3, 4));
+    EXPECT_FALSE(scc.stronglyConnected(1, 2));
+    EXPECT_EQ(scc.id(3), 0); // sink component is completed first
+    EXPECT_EQ(scc.id(2), 1);
+    EXPECT_EQ(scc.id(0), 2);
+    EXPECT_EQ(scc.id(5), 3);
+    EXPECT_THROW((void) scc.id(6), std::invalid_argument);
+}
+
+TEST(strong_components, pearce_deep) { // NOLINT
+    // a long cycle would overflow the call stack of a recursive DFS
+    constexpr int V = 2'000'000;
+    digraph::AdjacencyListDigraph dg(V);
+    for (int v = 0; v < V; ++v) dg.addEdge(v, (v + 1) % V);
+    dg.addEdge(0, V / 2);
+    const digraph::StronglyConnectedComponents cycle(dg, digraph::SccAlgorithm::Pearce);
+    EXPECT_EQ(cycle.numberOfComponents(), 1);
+
+    // a long path has one component per vertex, numbered from its end
+    digraph::AdjacencyListDigraph path(V);
+    for (int v = 0; v + 1 < V; ++v) path.addEdge(v, v + 1);
+    const digraph::StronglyConnectedComponents scc(path, digraph::SccAlgorithm::Pearce);
+    EXPECT_EQ(scc.numberOfComponents(), V);
+    EXPECT_EQ(scc.id(0), V - 1);
+    EXPECT_EQ(scc.id(V - 1), 0);
+}
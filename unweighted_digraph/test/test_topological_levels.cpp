@@ -0,0 +1,64 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "DigraphTopologicalLevels.h"
+#include "CsrDigraph.h"
+
+TEST(topological_levels, small) { // NOLINT
+    // 0->2, 1->2, 1->3, 2->4, 3->4, 0->4, 5 without edges
+    digraph::AdjacencyListDigraph dg(6);
+    dg.addEdge(0, 2);
+    dg.addEdge(1, 2);
+    dg.addEdge(1, 3);
+    dg.addEdge(2, 4);
+    dg.addEdge(3, 4);
+    dg.addEdge(0, 4);
+    const auto levels = digraph::topologicalLevels(dg);
+    EXPECT_TRUE(levels.acyclic());
+    EXPECT_EQ(levels.numLevels(), 3);
+    EXPECT_EQ(levels.order(), (std::vector<int>{0, 1, 5, 2, 3, 4}));
+    EXPECT_EQ(levels.levelBoundaries(), (std::vector<size_t>{0, 3, 5, 6}));
+    EXPECT_EQ(levels.level(1).size(), 2);
+    EXPECT_EQ(levels.level(1)[0], 2);
+    EXPECT_THROW((void) levels.level(3), std::invalid_argument);
+
+    // 2->1 closes the cycle 1->2->1, behind which 3 and 4 also remain
+    dg.addEdge(2, 1);
+    const auto withCycle = digraph::topologicalLevels(dg, 2);
+    EXPECT_FALSE(withCycle.acyclic());
+    EXPECT_EQ(withCycle.order(), (std::vector<int>{0, 5}));
+    EXPECT_EQ(withCycle.cycle(), (std::vector<int>{1, 2, 1})); // 2->4 is visited before 2->1
+
+    const auto empty = digraph::topologicalLevels(digraph::AdjacencyListDigraph(0));
+    EXPECT_TRUE(empty.acyclic());
+    EXPECT_EQ(empty.numLevels(), 0);
+}
+
+TEST(topological_levels, random_dags) { // NOLINT
+    std::mt19937 gen(23); // NOLINT
+    constexpr int V = 5000;
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    digraph::AdjacencyListDigraph dg(V);
+    for (int i = 0; i < 4 * V; ++i) {
+        const int a = vertexDist(gen), b = vertexDist(gen);
+        if (a != b) dg.addEdge(std::max(a, b), std::min(a, b)); // edges to smaller IDs
+    }
+    const auto levels = digraph::topologicalLevels(dg, 1);
+    ASSERT_TRUE(levels.acyclic());
+    ASSERT_EQ(levels.order().size(), static_cast<size_t>(V));
+
+    // every vertex is one level behind its latest predecessor
+    std::vector<int> levelOf(V, -1);
+    for (int i = 0; i < levels.numLevels(); ++i) {
+        for (const int v : levels.level(i)) levelOf[v] = i;
+    }
+    std::vector<int> expected(V, 0);
+    for (int v = V - 1; v >= 0; --v) { // predecessors have larger IDs
+        for (const int w : dg.adj(v)) expected[w] = std::max(expected[w], expected[v] + 1);
+    }
+    EXPECT_EQ(levelOf, expected);
+
+    // same result on several threads and for other digraph types
+    const auto parallel = digraph::topologicalLevels(digraph::CsrDigraph(dg), 4);
+    EXPECT_EQ(parallel.order(), levels.order());
+    EXPECT_EQ(parallel.levelBoundaries(), levels.levelBoundaries());
+}
@@ -0,0 +1,94 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "Digraph.h"
+#include "CsrDigraph.h"
+
+namespace {
+    // whether order contains every vertex once and all edges point forward
+    bool isTopologicalOrder(const digraph::Digraph& dg, const std::vector<int>& order) {
+        if (static_cast<int>(order.size()) != dg.V()) return false;
+        std::vector<int> position(dg.V(), -1);
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (position[order[i]] != -1) return false;
+            position[order[i]] = static_cast<int>(i);
+        }
+        for (int v = 0; v < dg.V(); ++v) {
+            for (const int w : dg.adj(v)) {
+                if (position[v] >= position[w]) return false;
+            }
+        }
+        return true;
+    }
+
+    // whether cycle is a closed walk along edges of dg
+    bool isCycle(const digraph::Digraph& dg, const std::vector<int>& cycle) {
+        if (cycle.size() < 2 || cycle.front() != cycle.back()) return false;
+        for (size_t i = 0; i + 1 < cycle.size(); ++i) {
+            const auto adj = dg.adj(cycle[i]);
+            if (std::find(adj.begin(), adj.end(), cycle[i + 1]) == adj.end()) return false;
+        }
+        return true;
+    }
+}
+
+TEST(topological_sort, cycles) { // NOLINT
+    // 0->1->2->3->1: back edge 3->1
+    digraph::AdjacencyListDigraph dg(5);
+    dg.addEdge(0, 1);
+    dg.addEdge(1, 2);
+    dg.addEdge(2, 3);
+    dg.addEdge(3, 1);
+    dg.addEdge(4, 0);
+    const auto cycle = digraph::containsCycle(dg);
+    ASSERT_TRUE(cycle.has_value());
+    EXPECT_EQ(*cycle, (std::vector<int>{3, 1, 2, 3}));
+    EXPECT_THROW((void) digraph::topologicalSort(dg), std::invalid_argument);
+
+    digraph::AdjacencyListDigraph selfLoop(2);
+    selfLoop.addEdge(0, 1);
+    selfLoop.addEdge(1, 1);
+    EXPECT_EQ(digraph::containsCycle(selfLoop), (std::vector<int>{1, 1}));
+}
+
+TEST(topological_sort, random_dags) { // NOLINT
+    std::mt19937 gen(17); // NOLINT
+    for (const int V : {1, 10, 100, 1000}) {
+        // edges from smaller to larger positions of a random permutation
+        std::vector<int> permutation(V);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::shuffle(permutation.begin(), permutation.end(), gen);
+        std::uniform_int_distribution<int> positionDist(0, V - 1);
+        digraph::AdjacencyListDigraph dg(V);
+        for (int i = 0; i < 3 * V; ++i) {
+            const int a = positionDist(gen), b = positionDist(gen);
+            if (a != b) dg.addEdge(permutation[std::min(a, b)], permutation[std::max(a, b)]);
+        }
+        EXPECT_FALSE(digraph::containsCycle(dg).has_value());
+        EXPECT_TRUE(isTopologicalOrder(dg, digraph::topologicalSort(dg)));
+        EXPECT_EQ(digraph::topologicalSort(digraph::CsrDigraph(dg)), digraph::topologicalSort(dg));
+
+        // one edge backwards closes a cycle
+        if (V > 1) {
+            dg.addEdge(permutation[V - 1], permutation[0]);
+            const auto cycle = digraph::containsCycle(dg);
+            ASSERT_TRUE(cycle.has_value());
+            EXPECT_TRUE(isCycle(dg, *cycle));
+        }
+    }
+}
+
+TEST(topological_sort, deep) { // NOLINT
+    // a long path would overflow the call stack of a recursive DFS
+    constexpr int V = 2'000'000;
+    digraph::AdjacencyListDigraph path(V);
+    for (int v = V - 1; v > 0; --v) path.addEdge(v, v - 1);
+    const auto order = digraph::topologicalSort(path);
+    ASSERT_EQ(order.size(), static_cast<size_t>(V));
+    EXPECT_EQ(order.front(), V - 1);
+    EXPECT_EQ(order.back(), 0);
+
+    path.addEdge(0, V - 1);
+    const auto cycle = digraph::containsCycle(path);
+    ASSERT_TRUE(cycle.has_value());
+    EXPECT_EQ(cycle->size(), static_cast<size_t>(V) + 1);
+}
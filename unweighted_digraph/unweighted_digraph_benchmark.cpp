@@ -0,0 +1,102 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include "Digraph.h"
+#include "CsrDigraph.h"
+#include "ParallelStronglyConnectedComponents.h"
+#include "ReachabilityIndex.h"
+#include "BenchmarkHelpers.h"
+
+// Benchmarks for Digraph.h algorithms on random digraphs (build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers)
+// Usage: unweighted_digraph_benchmark [number of vertices] [average out-degree]
+
+// create digraph with numV vertices and numV*avgDegree edges whose targets are skewed towards small vertex IDs,
+// which gives a giant strong component and many trivial ones like in web graphs
+digraph::CsrDigraph randomDigraph(const int numV, const int avgDegree) {
+    std::mt19937 gen(1234); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    std::uniform_real_distribution<double> unitDist(0.0, 1.0);
+    digraph::AdjacencyListDigraph dg(numV);
+    for (long long i = 0; i < static_cast<long long>(numV) * avgDegree; ++i) {
+        const double r = unitDist(gen);
+        dg.addEdge(vertexDist(gen), static_cast<int>(r * r * (numV - 1)));
+    }
+    return digraph::CsrDigraph(dg);
+}
+
+// serial Pearce (Kosaraju-Sharir recurses too deeply for large digraphs) vs. parallel trim, forward-backward and
+// coloring with increasing number of threads
+void benchmarkStrongComponents(const digraph::CsrDigraph& dg) {
+    using namespace digraph;
+    std::cout << "--- Strong components: serial Pearce vs. parallel trim, forward-backward and coloring ---\n";
+    const StronglyConnectedComponents pearce(dg, SccAlgorithm::Pearce);
+    std::cout << pearce.numberOfComponents() << " components\n";
+    const double serialMs = timeMs([&] { StronglyConnectedComponents(dg, SccAlgorithm::Pearce); });
+    std::cout << "serial:              " << std::setw(10) << serialMs << " ms\n";
+    for (unsigned threads = 1; threads <= 2 * defaultNumThreads(); threads *= 2) {
+        const double parallelMs = timeMs([&] { stronglyConnectedComponentsParallel(dg, threads); });
+        std::cout << "parallel, " << std::setw(3) << threads << " threads: " << std::setw(10) << parallelMs
+                  << " ms (speedup " << serialMs / parallelMs << ")\n";
+    }
+}
+
+// reachability queries between random vertices of a random DAG (edges from smaller to larger IDs, so that the
+// condensation does not answer the queries already): BFS per query vs. condensation with GRAIL labels
+void benchmarkReachability(const int numV, const int avgDegree) {
+    std::cout << "--- Reachability queries on a DAG: BFS vs. ReachabilityIndex ---\n";
+    std::mt19937 gen(42); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    digraph::AdjacencyListDigraph dag(numV);
+    for (long long i = 0; i < static_cast<long long>(numV) * avgDegree; ++i) {
+        const int a = vertexDist(gen), b = vertexDist(gen);
+        if (a != b) dag.addEdge(std::min(a, b), std::max(a, b));
+    }
+    const digraph::CsrDigraph dg(dag);
+
+    constexpr int numQueries = 100000;
+    constexpr int numBfsQueries = 20;
+    std::vector<std::pair<int, int>> queries(numQueries);
+    for (auto& query : queries) query = {vertexDist(gen), vertexDist(gen)};
+
+    const double bfsMs = timeMs([&] {
+        std::vector<bool> reached(dg.V());
+        for (int q = 0; q < numBfsQueries; ++q) {
+            std::fill(reached.begin(), reached.end(), false);
+            std::vector<int> queue{queries[q].first};
+            reached[queries[q].first] = true;
+            for (size_t head = 0; head < queue.size() && !reached[queries[q].second]; ++head) {
+                for (const int w : dg.adjUnchecked(queue[head])) {
+                    if (!reached[w]) {
+                        reached[w] = true;
+                        queue.push_back(w);
+                    }
+                }
+            }
+        }
+    }, 1);
+    std::cout << "BFS:            " << std::setw(10) << 1000.0 * bfsMs / numBfsQueries << " us per query\n";
+    std::unique_ptr<digraph::ReachabilityIndex> index{};
+    const double buildMs = timeMs([&] { index = std::make_unique<digraph::ReachabilityIndex>(dg); }, 1);
+    int numReachable = 0;
+    const double queryMs = timeMs([&] {
+        numReachable = 0;
+        for (const auto& [u, v] : queries) numReachable += index->reachable(u, v) ? 1 : 0;
+    }, 1);
+    std::cout << "index:          " << std::setw(10) << 1000.0 * queryMs / numQueries << " us per query ("
+              << numReachable << " of " << numQueries << " reachable), built in " << buildMs << " ms, "
+              << index->memoryBytes() / 1048576.0 << " MiB\n";
+}
+
+int main(int argc, char* argv[]) {
+    const int numV = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const int avgDegree = argc > 2 ? std::stoi(argv[2]) : 8;
+    std::cout << "Creating random digraph with " << numV << " vertices and average out-degree " << avgDegree << "\n";
+    const auto dg = randomDigraph(numV, avgDegree);
+    std::cout << std::fixed << std::setprecision(2);
+
+    benchmarkStrongComponents(dg);
+    benchmarkReachability(numV, avgDegree);
+
+    return 0;
+}
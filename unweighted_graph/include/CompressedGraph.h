@@ -0,0 +1,100 @@
+#ifndef GRAPHS_CPP_COMPRESSEDGRAPH_H
+#define GRAPHS_CPP_COMPRESSEDGRAPH_H
+
+#include "Graph.h"
+#include "CompressedSparseRows.h"
+#include "VarintRows.h"
+
+namespace graph {
+
+    // Immutable graph whose sorted adjacencies are stored as varint-encoded gaps (see VarintRows.h)
+    // Adjacent vertices are decoded while iterating, so adj(v) returns a range instead of an ArrayView and the class
+    // does not implement the Graph interface. The algorithm templates (see GraphConcept.h) such as
+    // find_paths_to_all::fromVertexToAllBfs, ConnectedComponents and isBipartite run on it directly.
+    // Relabel the graph with a cache-friendly vertex order first (see GraphReordering.h) to get small gaps.
+    class CompressedGraph {
+    public:
+        // create compressed copy of another graph (adjacent vertices are sorted)
+        template<typename G, EnableIfGraphLike<G> = 0>
+        explicit CompressedGraph(const G& g) : numV(g.V()), numE(g.E()),
+                                               rows(g.V(), [&g](const int v) { return uncheckedAdj(g, v); }) {}
+
+        // create graph with input stream (same format as AdjacencyListGraph)
+        explicit CompressedGraph(std::istream& is) {
+            const auto endpoints = ::internal::readEdgeEndpoints(is, numV, numE);
+            rows = fromCsr(CompressedSparseRows::fromEndpoints(numV, endpoints, true));
+        }
+
+        // create graph from an edge list (see EdgeListLoader.h)
+        explicit CompressedGraph(const EdgeList& edgeList) :
+                numV(edgeList.numV), numE(edgeList.numE),
+                rows(fromCsr(CompressedSparseRows::fromEndpoints(edgeList.numV, edgeList.endpoints, true))) {}
+
+        // get vertices adjacent to v in ascending order
+        [[nodiscard]] VarintRows::Row adj(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return rows.row(v);
+        }
+
+        // get vertices adjacent to v in ascending order without bounds check (see GraphConcept.h)
+        [[nodiscard]] VarintRows::Row adjUnchecked(const int v) const {
+            return rows.row(v);
+        }
+
+        // number of vertices adjacent to v (self-loops count twice)
+        [[nodiscard]] int degree(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return static_cast<int>(rows.rowSize(v));
+        }
+
+        // whether edge v-w exists (decodes at most one block of the adjacencies of v)
+        [[nodiscard]] bool hasEdge(const int v, const int w) const {
+            if (!vertexValid(v) || !vertexValid(w)) throw std::invalid_argument("Invalid vertex");
+            return rows.contains(v, w);
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const {
+            return numV;
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const {
+            return numE;
+        }
+
+        // bytes used by the adjacencies
+        [[nodiscard]] size_t memoryBytes() const {
+            return rows.memoryBytes();
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const {
+            std::stringstream ss;
+            ss << "[Graph with " << numV << " vertices and " << numE << " edges]\n";
+            for (int i = 0; i < numV; ++i) {
+                for (const auto edge : rows.row(i)) {
+                    ss << i << "-" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(const int v) const {
+            return v >= 0 && v < numV;
+        }
+
+    private:
+        int numV = 0; // vertices
+        int numE = 0; // edges
+        VarintRows rows{}; // adjacencies of all vertices (each edge v-w is saved as v->w and w->v)
+
+        static VarintRows fromCsr(const CompressedSparseRows& csr) {
+            return VarintRows(csr.numRows(), [&csr](const int v) { return csr.row(v); });
+        }
+    };
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_COMPRESSEDGRAPH_H
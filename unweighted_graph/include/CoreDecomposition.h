@@ -0,0 +1,191 @@
+#ifndef GRAPHS_CPP_COREDECOMPOSITION_H
+#define GRAPHS_CPP_COREDECOMPOSITION_H
+
+#include <atomic>
+#include <cstdint>
+#include "Graph.h"
+#include "Parallel.h"
+
+namespace graph {
+
+    // class to calculate the core number of every vertex (https://en.wikipedia.org/wiki/Degeneracy_(graph_theory))
+    // The k-core is the largest subgraph in which every vertex has at least k neighbors; the core number of a vertex is
+    // the largest k for which it is part of the k-core. Degrees are counted like graph::degree, i.e. self-loops count
+    // twice and parallel edges separately.
+    class CoreDecomposition {
+    public:
+        // calculate core numbers of graph g
+        // with numThreads == 1 with the O(V+E) bucket algorithm by Batagelj and Zaversnik,
+        // otherwise by level-synchronous parallel peeling on numThreads threads (0: default number of threads)
+        explicit CoreDecomposition(const Graph& g, const unsigned numThreads = 1) : cores(g.V(), 0) {
+            if (numThreads == 1) {
+                peelSequential(g);
+            } else {
+                peelParallel(g, numThreads);
+            }
+            for (const int core : cores) maxCore = std::max(maxCore, core);
+            numWithCoreAtLeast.assign(static_cast<size_t>(maxCore) + 2, 0);
+            for (const int core : cores) ++numWithCoreAtLeast[core];
+            for (int k = maxCore - 1; k >= 0; --k) numWithCoreAtLeast[k] += numWithCoreAtLeast[k + 1];
+        }
+
+        // core number of vertex v
+        [[nodiscard]] int coreNumber(const int v) const {
+            if(!internal::validIndex(cores, v)) throw std::invalid_argument("Invalid vertex");
+            return cores[v];
+        }
+
+        // core numbers of all vertices
+        [[nodiscard]] const std::vector<int>& coreNumbers() const {
+            return cores;
+        }
+
+        // largest core number of any vertex (degeneracy of the graph)
+        [[nodiscard]] int maxCoreNumber() const {
+            return maxCore;
+        }
+
+        // whether vertex v is part of the k-core
+        [[nodiscard]] bool inKCore(const int v, const int k) const {
+            return coreNumber(v) >= k;
+        }
+
+        // number of vertices in the k-core
+        [[nodiscard]] int kCoreSize(const int k) const {
+            if (k < 0) throw std::invalid_argument("Invalid k");
+            return k > maxCore ? 0 : numWithCoreAtLeast[k];
+        }
+
+        // vertices of the k-core in ascending order
+        [[nodiscard]] std::vector<int> kCore(const int k) const {
+            std::vector<int> result{};
+            result.reserve(kCoreSize(k));
+            for (int v = 0; static_cast<size_t>(v) < cores.size(); ++v) {
+                if (cores[v] >= k) result.push_back(v);
+            }
+            return result;
+        }
+
+    private:
+        std::vector<int> cores; // core number of each vertex
+        int maxCore = 0; // largest core number
+        std::vector<int> numWithCoreAtLeast{}; // number of vertices with core number >= k for k = 0...maxCore+1
+
+        // Batagelj-Zaversnik: keep vertices sorted by current degree in buckets and always remove one of minimal degree
+        void peelSequential(const Graph& g) {
+            const int V = g.V();
+            std::vector<int> deg(V);
+            int maxDegree = 0;
+            for (int v = 0; v < V; ++v) {
+                deg[v] = static_cast<int>(g.adj(v).size());
+                maxDegree = std::max(maxDegree, deg[v]);
+            }
+            // vertices sorted by degree (vert), position of each vertex in vert (pos), start of each bucket (bin)
+            std::vector<int> bin(static_cast<size_t>(maxDegree) + 1, 0);
+            for (int v = 0; v < V; ++v) ++bin[deg[v]];
+            for (int d = 0, start = 0; d <= maxDegree; ++d) {
+                const int num = bin[d];
+                bin[d] = start;
+                start += num;
+            }
+            std::vector<int> vert(V), pos(V);
+            for (int v = 0; v < V; ++v) {
+                pos[v] = bin[deg[v]]++;
+                vert[pos[v]] = v;
+            }
+            for (int d = maxDegree; d > 0; --d) bin[d] = bin[d - 1];
+            bin[0] = 0;
+
+            for (int i = 0; i < V; ++i) {
+                const int v = vert[i];
+                cores[v] = deg[v];
+                for (const int w : g.adj(v)) {
+                    if (deg[w] > deg[v]) {
+                        // move w to the front of its bucket and shrink the bucket by one
+                        const int dw = deg[w];
+                        const int pw = pos[w];
+                        const int firstPos = bin[dw];
+                        const int first = vert[firstPos];
+                        if (first != w) {
+                            std::swap(vert[pw], vert[firstPos]);
+                            pos[w] = firstPos;
+                            pos[first] = pw;
+                        }
+                        ++bin[dw];
+                        --deg[w];
+                    }
+                }
+            }
+        }
+
+        // Parallel peeling: remove all vertices of degree <= k at once, level by level
+        // Vertices wait in buckets by degree, so a level only looks at its own bucket and at the vertices whose degree
+        // dropped, never at all remaining vertices. Bucket entries of a vertex whose degree dropped further since are
+        // stale, as it is removed on a lower level first.
+        void peelParallel(const Graph& g, const unsigned numThreads) {
+            const int V = g.V();
+            const unsigned threads = resolveNumThreads(numThreads);
+            std::vector<std::atomic<int>> deg(V);
+            std::vector<std::atomic<uint8_t>> touched(V); // whether a vertex is in a buffer of touchedBuffers
+            int maxDegree = 0;
+            parallelFor(0, V, threads, [&](const size_t v, unsigned) {
+                deg[v].store(static_cast<int>(g.adj(static_cast<int>(v)).size()), std::memory_order_relaxed);
+                touched[v].store(0, std::memory_order_relaxed);
+            }, 1024);
+            for (int v = 0; v < V; ++v) maxDegree = std::max(maxDegree, deg[v].load(std::memory_order_relaxed));
+            std::vector<std::vector<int>> buckets(static_cast<size_t>(maxDegree) + 1); // vertices by degree
+            for (int v = 0; v < V; ++v) buckets[deg[v].load(std::memory_order_relaxed)].push_back(v);
+
+            std::vector<uint8_t> removed(V, 0);
+            std::vector<std::vector<int>> frontierBuffers(threads); // per-thread parts of the next frontier
+            std::vector<std::vector<int>> touchedBuffers(threads); // per-thread vertices with decremented degree
+            std::vector<int> frontier{};
+            for (int k = 0; k <= maxDegree; ++k) {
+                // (1) vertices which reached degree k on lower levels start the frontier
+                frontier.clear();
+                for (const int v : buckets[k]) {
+                    if (!removed[v]) frontier.push_back(v);
+                }
+                std::vector<int>().swap(buckets[k]);
+
+                // (2) remove frontier; neighbors whose degree drops to k join the next frontier, all other neighbors
+                //     with a decremented degree move into the bucket of their new degree
+                while (!frontier.empty()) {
+                    for (const int v : frontier) {
+                        removed[v] = 1;
+                        cores[v] = k;
+                    }
+                    parallelFor(0, frontier.size(), threads, [&](const size_t i, const unsigned threadId) {
+                        for (const int w : g.adj(frontier[i])) {
+                            if (deg[w].load(std::memory_order_relaxed) <= k) continue;
+                            const int old = deg[w].fetch_sub(1, std::memory_order_relaxed);
+                            if (old == k + 1) {
+                                frontierBuffers[threadId].push_back(w);
+                            } else if (old <= k) {
+                                deg[w].fetch_add(1, std::memory_order_relaxed); // decremented concurrently
+                            } else if (touched[w].exchange(1, std::memory_order_relaxed) == 0) {
+                                touchedBuffers[threadId].push_back(w);
+                            }
+                        }
+                    }, 64);
+                    for (auto& buffer : touchedBuffers) {
+                        for (const int w : buffer) {
+                            touched[w].store(0, std::memory_order_relaxed);
+                            const int d = deg[w].load(std::memory_order_relaxed);
+                            if (d > k) buckets[d].push_back(w); // otherwise w is in the next frontier
+                        }
+                        buffer.clear();
+                    }
+                    frontier.clear();
+                    for (auto& buffer : frontierBuffers) {
+                        frontier.insert(frontier.end(), buffer.begin(), buffer.end());
+                        buffer.clear();
+                    }
+                }
+            }
+        }
+    };
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_COREDECOMPOSITION_H
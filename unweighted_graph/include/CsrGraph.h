@@ -0,0 +1,100 @@
+#ifndef GRAPHS_CPP_CSRGRAPH_H
+#define GRAPHS_CPP_CSRGRAPH_H
+
+#include "Graph.h"
+#include "CompressedSparseRows.h"
+
+namespace graph {
+
+    // Immutable graph in compressed sparse row (CSR) format (https://en.wikipedia.org/wiki/Sparse_matrix)
+    // All adjacencies are stored in one contiguous array instead of one vector per vertex, which saves the
+    // per-vertex allocations and keeps the adjacencies of consecutive vertices next to each other in memory.
+    class CsrGraph : public Graph {
+    public:
+        // create frozen copy of another graph (keeps the order of adjacent vertices)
+        explicit CsrGraph(const Graph& g) : numV(g.V()), numE(g.E()) {
+            std::vector<size_t> offsets(static_cast<size_t>(numV) + 1, 0);
+            for (int v = 0; v < numV; ++v) {
+                offsets[v + 1] = offsets[v] + g.adj(v).size();
+            }
+            std::vector<int> targets{};
+            targets.reserve(offsets.back());
+            for (int v = 0; v < numV; ++v) {
+                const auto adjacent = g.adj(v);
+                targets.insert(targets.end(), adjacent.begin(), adjacent.end());
+            }
+            rows = CompressedSparseRows(std::move(offsets), std::move(targets));
+        }
+
+        // create graph with input stream (same format as AdjacencyListGraph)
+        explicit CsrGraph(std::istream& is) {
+            const auto endpoints = ::internal::readEdgeEndpoints(is, numV, numE);
+            rows = CompressedSparseRows::fromEndpoints(numV, endpoints, true);
+        }
+
+        // create graph from an edge list (see EdgeListLoader.h)
+        explicit CsrGraph(const EdgeList& edgeList) :
+                numV(edgeList.numV), numE(edgeList.numE),
+                rows(CompressedSparseRows::fromEndpoints(edgeList.numV, edgeList.endpoints, true)) {}
+
+        // create graph with V vertices from already built symmetric rows (two entries per edge)
+        CsrGraph(const int V, CompressedSparseRows&& _rows) :
+                numV(V), numE(static_cast<int>(_rows.numEntries() / 2)), rows(std::move(_rows)) {
+            if (rows.numRows() != numV) throw std::invalid_argument("Number of rows must match V");
+            if (rows.numEntries() % 2 != 0) throw std::invalid_argument("Rows must contain every edge twice");
+        }
+
+        // CSR graphs cannot be changed after creation
+        void addEdge(int, int) override {
+            throw std::logic_error("CsrGraph is immutable");
+        }
+
+        // get vertices adjacent to v
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return rows.row(v);
+        }
+
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return rows.row(v);
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const override {
+            return numV;
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const override {
+            return numE;
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const override {
+            std::stringstream ss;
+            ss << "[Graph with " << numV << " vertices and " << numE << " edges]\n";
+            for (int i = 0; i < numV; ++i) {
+                for (const auto edge : rows.row(i)) {
+                    ss << i << "-" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(int v) const override {
+            return v >= 0 && v < numV;
+        }
+
+    private:
+        int numV = 0; // vertices
+        int numE = 0; // edges
+        CompressedSparseRows rows{}; // adjacencies of all vertices (each edge v-w is saved as v->w and w->v)
+    };
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_CSRGRAPH_H
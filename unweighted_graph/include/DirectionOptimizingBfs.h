@@ -0,0 +1,115 @@
+#ifndef GRAPHS_CPP_DIRECTIONOPTIMIZINGBFS_H
+#define GRAPHS_CPP_DIRECTIONOPTIMIZINGBFS_H
+
+#include "Graph.h"
+#include "Bitmap.h"
+
+namespace graph::find_paths_to_all {
+
+    namespace internal {
+        // Top-down BFS step: visit all unvisited vertices adjacent to the frontier
+        // returns the sum of degrees of the next frontier
+        inline long long bfsTopDownStep(const Graph& g, const std::vector<int>& frontier, std::vector<int>& next,
+                                        std::vector<int>& distTo, std::vector<int>& edgeTo) {
+            long long nextEdges = 0;
+            next.clear();
+            for (const int v : frontier) {
+                for (const int other : g.adj(v)) {
+                    if (distTo[other] == -1) {
+                        distTo[other] = distTo[v] + 1;
+                        edgeTo[other] = v;
+                        next.push_back(other);
+                        nextEdges += static_cast<long long>(g.adj(other).size());
+                    }
+                }
+            }
+            return nextEdges;
+        }
+
+        // Bottom-up BFS step: every unvisited vertex looks for an adjacent vertex in the frontier
+        // and stops at the first one found. Sets numNext to the size of the next frontier
+        // and returns the sum of its degrees.
+        inline long long bfsBottomUpStep(const Graph& g, const Bitmap& frontier, Bitmap& next, const int level,
+                                         std::vector<int>& distTo, std::vector<int>& edgeTo, size_t& numNext) {
+            long long nextEdges = 0;
+            numNext = 0;
+            next.clear();
+            for (int v = 0; v < g.V(); ++v) {
+                if (distTo[v] != -1) continue;
+                const auto adjacent = g.adj(v);
+                for (const int other : adjacent) {
+                    if (frontier.test(other)) {
+                        // found parent in frontier -> no need to check the remaining adjacent vertices
+                        distTo[v] = level + 1;
+                        edgeTo[v] = other;
+                        next.set(v);
+                        ++numNext;
+                        nextEdges += static_cast<long long>(adjacent.size());
+                        break;
+                    }
+                }
+            }
+            return nextEdges;
+        }
+    } // namespace internal
+
+    // Direction-optimizing breadth-first search from vertex start to all reachable vertices
+    // (Beamer et al., "Direction-Optimizing Breadth-First Search", 2012)
+    // Each level is expanded top-down (frontier checks its adjacent vertices) while the frontier is small and
+    // bottom-up (unvisited vertices look for a parent in the frontier) while it is large, which skips most edge
+    // checks on low-diameter graphs. Distances equal those of fromVertexToAllBfs, but the chosen parents may differ.
+    // alpha: switch to bottom-up when the frontier has more than 1/alpha of the unexplored edges
+    // beta: switch back to top-down when the frontier has fewer than V/beta vertices
+    inline PathsFromVertexResult fromVertexToAllBfsDirectionOptimizing(const Graph& g, const int start,
+                                                                       const int alpha = 15, const int beta = 18) {
+        if (!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
+        if (alpha <= 0 || beta <= 0) throw std::invalid_argument("alpha and beta must be positive");
+
+        std::vector<int> distTo(g.V(), -1); // number of steps from start to vertex
+        std::vector<int> edgeTo(g.V(), -1); // from which vertex another vertex was visited from the first time
+
+        long long unexploredEdges = 0; // sum of degrees of all unvisited vertices
+        for (int v = 0; v < g.V(); ++v) {
+            unexploredEdges += static_cast<long long>(g.adj(v).size());
+        }
+
+        std::vector<int> frontierQueue{start}, nextQueue{}; // frontier for top-down steps
+        Bitmap frontierBits(g.V()), nextBits(g.V()); // frontier for bottom-up steps
+        distTo[start] = 0;
+        long long frontierEdges = static_cast<long long>(g.adj(start).size());
+        unexploredEdges -= frontierEdges;
+        size_t frontierSize = 1;
+        bool bottomUp = false;
+
+        for (int level = 0; frontierSize > 0; ++level) {
+            if (!bottomUp && frontierEdges > unexploredEdges / alpha) {
+                // frontier is large -> switch to bitmap representation
+                frontierBits.clear();
+                for (const int v : frontierQueue) frontierBits.set(v);
+                bottomUp = true;
+            } else if (bottomUp && frontierSize < static_cast<size_t>(g.V() / beta)) {
+                // frontier is small again -> switch to queue representation
+                frontierQueue.clear();
+                frontierBits.forEachSet([&](const size_t v) { frontierQueue.push_back(static_cast<int>(v)); });
+                bottomUp = false;
+            }
+
+            if (bottomUp) {
+                frontierEdges = internal::bfsBottomUpStep(g, frontierBits, nextBits, level, distTo, edgeTo,
+                                                          frontierSize);
+                frontierBits.swap(nextBits);
+            } else {
+                frontierEdges = internal::bfsTopDownStep(g, frontierQueue, nextQueue, distTo, edgeTo);
+                frontierQueue.swap(nextQueue);
+                frontierSize = frontierQueue.size();
+            }
+            unexploredEdges -= frontierEdges;
+        }
+
+        // return queryable results
+        return PathsFromVertexResult(start, std::move(distTo), std::move(edgeTo));
+    }
+
+} // namespace graph::find_paths_to_all
+
+#endif //GRAPHS_CPP_DIRECTIONOPTIMIZINGBFS_H
@@ -8,6 +8,10 @@
 #include <deque>
 #include <queue>
 #include <stack>
+#include <stdexcept>
+#include "ArrayView.h"
+#include "EdgeList.h"
+#include "GraphConcept.h"
 
 namespace graph {
 
@@ -15,7 +19,7 @@ namespace graph {
     class Graph {
     public:
         virtual void addEdge(int v, int w) = 0; // add edge v-w to graph
-        [[nodiscard]] virtual const std::vector<int>& adj(int v) const = 0; // get vertices adjacent to v
+        [[nodiscard]] virtual ArrayView<int> adj(int v) const = 0; // get vertices adjacent to v
         [[nodiscard]] virtual int V() const = 0; // number of vertices
         [[nodiscard]] virtual int E() const = 0; // number of edges
         [[nodiscard]] virtual std::string toString() const = 0; // create string representation
@@ -48,6 +52,22 @@ namespace graph {
             }
         }
 
+        // create graph from an edge list (see EdgeListLoader.h) with exactly reserved adjacency vectors
+        explicit AdjacencyListGraph(const EdgeList& edgeList) :
+                numV(edgeList.numV),
+                numE(edgeList.numE),
+                adjacencies(edgeList.numV, std::vector<int>{}) {
+            for (int v = 0; v < numV; ++v) {
+                adjacencies[v].reserve(edgeList.outDegree[v] + edgeList.inDegree[v]);
+            }
+            for (size_t i = 0; i < edgeList.endpoints.size(); i += 2) {
+                const int v1 = edgeList.endpoints[i];
+                const int v2 = edgeList.endpoints[i + 1];
+                adjacencies[v1].push_back(v2);
+                adjacencies[v2].push_back(v1);
+            }
+        }
+
         // add edge v-w to graph
         void addEdge(int v, int w) override {
             if (!vertexValid(v) || !vertexValid(w)) {
@@ -58,14 +78,25 @@ namespace graph {
             ++numE;
         }
 
+        // add a vertex without edges to graph and return it
+        virtual int addVertex() {
+            adjacencies.emplace_back();
+            return numV++;
+        }
+
         // get vertices adjacent to v
-        [[nodiscard]] const std::vector<int>& adj(int v) const override {
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
             if (!vertexValid(v)) {
                 throw std::invalid_argument("Invalid vertex");
             }
             return adjacencies[v];
         }
 
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return adjacencies[v];
+        }
+
         // number of vertices
         [[nodiscard]] int V() const override {
             return numV;
@@ -101,13 +132,13 @@ namespace graph {
     };
 
     // degree of a vertex
-    int degree(const Graph& g, const int v) {
+    inline int degree(const Graph& g, const int v) {
         if(!g.vertexValid(v)) throw std::invalid_argument("Invalid vertex");
         return g.adj(v).size();
     }
 
     // maximum degree of any vertex in graph
-    int maxDegree(const Graph& g) {
+    inline int maxDegree(const Graph& g) {
         int deg = 0;
         for(int i=0; i<g.V(); ++i) {
             deg = std::max(deg, static_cast<int>(g.adj(i).size()));
@@ -117,12 +148,12 @@ namespace graph {
     }
 
     // average degree of vertices
-    double avgDegree(const Graph& g) {
+    inline double avgDegree(const Graph& g) {
         return 2.0 * g.E() / g.V();
     }
 
     // count the number of self-loops
-    int numSelfLoops(const Graph& g) {
+    inline int numSelfLoops(const Graph& g) {
         int num = 0;
         for(int i=0; i<g.V(); ++i) {
             for(const auto& e : g.adj(i)) {
@@ -132,35 +163,33 @@ namespace graph {
         return num/2; // each self-loop is counted twice
     }
 
-    namespace internal {
-        // Check all unvisited vertices connected to v recursively with DFS for whether they prevent bipartiteness
-        bool isBipartiteRec(const Graph& g, const int v, const int lastSetId, std::vector<int>& setId) { // NOLINT
-            const int expectedSetId = lastSetId == 0 ? 1 : 0; // value which vertices adjacent to v must have
-            // check all vertices adjacent to v
-            for(const int other : g.adj(v)) {
-                if(setId[other] == -1) {
-                    // yet unvisited -> visit
-                    setId[other] = expectedSetId;
-                    if(!internal::isBipartiteRec(g, other, expectedSetId, setId)) return false;
-                } else if(setId[other] != expectedSetId) {
-                    // mismatch! -> not bipartite
-                    return false;
-                } // else everything okay
-            }
-            return true;
-        }
-    }
-
     // check whether graph is bipartite, i.e. the vertices can be divided into two disjoint sets such that every edge
     // connects a vertex from one set to a vertex of the other set
-    bool isBipartite(const Graph& g) {
-        // assign 0 and 1 in alternation to all vertices via DFS
+    // (template for all graph types, see GraphConcept.h)
+    template<typename G, EnableIfGraphLike<G> = 0>
+    bool isBipartite(const G& g) {
+        // assign 0 and 1 in alternation to all vertices via BFS (iterative, so long paths cannot overflow the stack)
         std::vector<int> setId(g.V(), -1);
+        std::vector<int> queue{}; // vertices in the order of their visit; the unprocessed ones start at head
         for(int i=0; i<g.V(); ++i) {
-            if(setId[i] == -1) {
-                // yet unvisited component
-                setId[i] = 0;
-                if(!internal::isBipartiteRec(g, i, 0, setId)) return false;
+            if(setId[i] != -1) continue;
+            // yet unvisited component
+            setId[i] = 0;
+            queue.clear();
+            queue.push_back(i);
+            for(size_t head = 0; head < queue.size(); ++head) {
+                const int v = queue[head];
+                const int expectedSetId = 1 - setId[v]; // value which vertices adjacent to v must have
+                for(const int other : uncheckedAdj(g, v)) {
+                    if(setId[other] == -1) {
+                        // yet unvisited -> visit
+                        setId[other] = expectedSetId;
+                        queue.push_back(other);
+                    } else if(setId[other] != expectedSetId) {
+                        // mismatch! -> not bipartite
+                        return false;
+                    } // else everything okay
+                }
             }
         }
 
@@ -235,6 +264,15 @@ namespace graph {
                 }
             }
 
+            // vertex from which v was visited first (-1 for start and unreachable vertices)
+            [[nodiscard]] int previousVertex(const int v) const {
+                if(!graph::internal::validIndex(edgeTo, v)) {
+                    return -1;
+                } else {
+                    return edgeTo[v];
+                }
+            }
+
             bool operator==(const PathsFromVertexResult& rhs) const {
                 if(this == &rhs) return true;
                 // compare sizes
@@ -259,7 +297,7 @@ namespace graph {
         };
 
         // Depth-first search from vertex start to all reachable vertices without recursion
-        PathsFromVertexResult fromVertexToAllDfsNoRec(const Graph &g, const int start) {
+        inline PathsFromVertexResult fromVertexToAllDfsNoRec(const Graph &g, const int start) {
             if(!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
 
             std::vector<int> distTo(g.V(), -1); // number of steps from start to vertex
@@ -294,7 +332,7 @@ namespace graph {
 
         namespace internal {
             // Recursive function for depth first search to all vertices from v
-            void fromVertexToAllDfsRec(const Graph& g, const int v, // NOLINT
+            inline void fromVertexToAllDfsRec(const Graph& g, const int v, // NOLINT
                                     std::vector<int>& distTo, std::vector<int>& edgeTo) {
                 for(const int other : g.adj(v)) {
                     if(distTo[other] == -1) {
@@ -308,7 +346,7 @@ namespace graph {
         }
 
         // Depth-first search from vertex start to all reachable vertices
-        PathsFromVertexResult fromVertexToAllDfs(const Graph &g, const int start) {
+        inline PathsFromVertexResult fromVertexToAllDfs(const Graph &g, const int start) {
             if(!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
 
             std::vector<int> distTo(g.V(), -1); // number of steps from start to vertex
@@ -323,7 +361,9 @@ namespace graph {
         }
 
         // Breadth-first search from vertex start to all reachable vertices
-        PathsFromVertexResult fromVertexToAllBfs(const Graph &g, const int start) {
+        // (template for all graph types, see GraphConcept.h)
+        template<typename G, EnableIfGraphLike<G> = 0>
+        PathsFromVertexResult fromVertexToAllBfs(const G &g, const int start) {
             if(start < 0 || start >= g.V()) throw std::invalid_argument("Invalid start vertex");
 
             std::vector<int> distTo(g.V(), -1); // number of steps from start to vertex
@@ -337,7 +377,7 @@ namespace graph {
                 const int v = queue.front();
                 queue.pop();
                 // add all yet unvisited adjacent vertices to queue and mark them
-                for (const int other : g.adj(v)) {
+                for (const int other : uncheckedAdj(g, v)) {
                     if (distTo[other] == -1) {
                         // yet unvisited
                         queue.push(other);
@@ -355,8 +395,9 @@ namespace graph {
     // class to calculate connected components in graph
     class ConnectedComponents {
     public:
-        // calculate connected components of graph g
-        explicit ConnectedComponents(const Graph& g)
+        // calculate connected components of graph g (for all graph types, see GraphConcept.h)
+        template<typename G, EnableIfGraphLike<G> = 0>
+        explicit ConnectedComponents(const G& g)
                                     :
                                     componentId(g.V(), -1), numComponents(0), numVerticesPerComponent{} {
             // go to all vertices of graph
@@ -364,12 +405,31 @@ namespace graph {
                 if (componentId[i] == -1) {
                     // yet unvisited
                     numVerticesPerComponent.push_back(0);
-                    dfs(g, i); // visit all connected vertices through recursive DFS
+                    dfs(g, i); // visit all connected vertices through iterative DFS
                     ++numComponents;
                 }
             }
         }
 
+        // connected components from a label per vertex (vertices with equal labels are connected)
+        // components are numbered like by the constructor, i.e. in the order of their smallest vertex
+        static ConnectedComponents fromLabels(const std::vector<int>& label) {
+            ConnectedComponents result{};
+            result.componentId.assign(label.size(), -1);
+            std::vector<int> idOfLabel(label.size(), -1);
+            for(size_t v = 0; v < label.size(); ++v) {
+                if(!internal::validIndex(label, label[v])) throw std::invalid_argument("Invalid label");
+                int& id = idOfLabel[label[v]];
+                if(id == -1) {
+                    id = result.numComponents++;
+                    result.numVerticesPerComponent.push_back(0);
+                }
+                result.componentId[v] = id;
+                ++result.numVerticesPerComponent[id];
+            }
+            return result;
+        }
+
         // number of connected components
         [[nodiscard]] int count() const {
             return numComponents;
@@ -413,14 +473,23 @@ namespace graph {
 
         std::vector<int> numVerticesPerComponent; // to make executing components() faster
 
-        // Recursive DFS for finding connected components
-        void dfs(const Graph& g, const int v) { // NOLINT
-            componentId[v] = numComponents; // mark as visited and set component id
-            ++numVerticesPerComponent.back(); // increase number of vertices in current component
-            for(const int other : g.adj(v)) {
-                // visit all unvisited adjacent vertices
-                if(componentId[other] == -1) {
-                    dfs(g, other);
+        ConnectedComponents() : numComponents(0) {}
+
+        // DFS with an explicit stack for finding connected components
+        template<typename G>
+        void dfs(const G& g, const int start) {
+            std::vector<int> stack{start};
+            componentId[start] = numComponents; // mark as visited and set component id
+            while(!stack.empty()) {
+                const int v = stack.back();
+                stack.pop_back();
+                ++numVerticesPerComponent.back(); // increase number of vertices in current component
+                for(const int other : uncheckedAdj(g, v)) {
+                    // visit all unvisited adjacent vertices
+                    if(componentId[other] == -1) {
+                        componentId[other] = numComponents;
+                        stack.push_back(other);
+                    }
                 }
             }
         }
@@ -0,0 +1,30 @@
+#ifndef GRAPHS_CPP_GRAPHBETWEENNESS_H
+#define GRAPHS_CPP_GRAPHBETWEENNESS_H
+
+#include "Graph.h"
+#include "BetweennessCentrality.h"
+
+namespace graph {
+
+    // betweenness centrality of every vertex with Brandes' algorithm (see BetweennessCentrality.h) in O(VE) on
+    // numThreads threads (0: default number of threads); every unordered pair of vertices is counted once
+    template<typename G, EnableIfGraphLike<G> = 0>
+    std::vector<double> betweennessCentrality(const G& g, const unsigned numThreads = 0) {
+        auto result = ::internal::unweightedBetweenness(g, ::internal::allSources, 0, numThreads);
+        for (auto& c : result) c /= 2; // both directions of every pair are counted
+        return result;
+    }
+
+    // estimate of the betweenness centrality from numSamples random sources (with random generator seed), which
+    // takes O(numSamples*E) instead of O(VE)
+    template<typename G, EnableIfGraphLike<G> = 0>
+    std::vector<double> approximateBetweennessCentrality(const G& g, const int numSamples, const unsigned numThreads = 0,
+                                                         const uint32_t seed = 1234) {
+        auto result = ::internal::unweightedBetweenness(g, numSamples, seed, numThreads);
+        for (auto& c : result) c /= 2; // both directions of every pair are counted
+        return result;
+    }
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_GRAPHBETWEENNESS_H
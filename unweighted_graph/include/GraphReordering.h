@@ -0,0 +1,68 @@
+#ifndef GRAPHS_CPP_GRAPHREORDERING_H
+#define GRAPHS_CPP_GRAPHREORDERING_H
+
+#include "Graph.h"
+#include "CsrGraph.h"
+#include "VertexReordering.h"
+
+namespace graph {
+
+    // adjacencies of g as compressed sparse rows (already symmetric for undirected graphs)
+    inline CompressedSparseRows toRows(const Graph& g) {
+        std::vector<size_t> offsets(static_cast<size_t>(g.V()) + 1, 0);
+        for (int v = 0; v < g.V(); ++v) {
+            offsets[v + 1] = offsets[v] + g.adj(v).size();
+        }
+        std::vector<int> targets{};
+        targets.reserve(offsets.back());
+        for (int v = 0; v < g.V(); ++v) {
+            const auto adjacent = g.adj(v);
+            targets.insert(targets.end(), adjacent.begin(), adjacent.end());
+        }
+        return CompressedSparseRows(std::move(offsets), std::move(targets));
+    }
+
+    // compute a cache-friendly vertex order of g (see VertexReordering.h)
+    inline VertexPermutation computeVertexOrder(const Graph& g, const VertexOrder order) {
+        return ::computeVertexOrder(toRows(g), order);
+    }
+
+    // copy of g in CSR format where vertex v is called permutation.toNew(v)
+    // the adjacent vertices of each vertex are sorted by their new IDs
+    inline CsrGraph relabel(const Graph& g, const VertexPermutation& permutation) {
+        if (permutation.size() != g.V()) throw std::invalid_argument("Permutation does not match graph");
+        std::vector<size_t> offsets(static_cast<size_t>(g.V()) + 1, 0);
+        for (int newId = 0; newId < g.V(); ++newId) {
+            offsets[newId + 1] = offsets[newId] + g.adj(permutation.toOld(newId)).size();
+        }
+        std::vector<int> targets(offsets.back());
+        for (int newId = 0; newId < g.V(); ++newId) {
+            auto pos = targets.begin() + static_cast<std::ptrdiff_t>(offsets[newId]);
+            for (const int w : g.adj(permutation.toOld(newId))) {
+                *pos++ = permutation.toNew(w);
+            }
+            std::sort(targets.begin() + static_cast<std::ptrdiff_t>(offsets[newId]), pos);
+        }
+        return CsrGraph(g.V(), CompressedSparseRows(std::move(offsets), std::move(targets)));
+    }
+
+    namespace find_paths_to_all {
+        // translate result of a search in a graph relabeled with permutation back to the original vertex IDs
+        inline PathsFromVertexResult toOriginalIds(const PathsFromVertexResult& result,
+                                                   const VertexPermutation& permutation) {
+            const int V = permutation.size();
+            std::vector<int> distTo(V, -1);
+            std::vector<int> edgeTo(V, -1);
+            for (int newId = 0; newId < V; ++newId) {
+                const int oldId = permutation.toOld(newId);
+                distTo[oldId] = result.distanceTo(newId);
+                const int previous = result.previousVertex(newId);
+                if (previous != -1) edgeTo[oldId] = permutation.toOld(previous);
+            }
+            return PathsFromVertexResult(permutation.toOld(result.from()), std::move(distTo), std::move(edgeTo));
+        }
+    } // namespace find_paths_to_all
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_GRAPHREORDERING_H
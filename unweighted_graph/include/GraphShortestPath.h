@@ -0,0 +1,25 @@
+#ifndef GRAPHS_CPP_GRAPHSHORTESTPATH_H
+#define GRAPHS_CPP_GRAPHSHORTESTPATH_H
+
+#include "Graph.h"
+#include "BidirectionalBfs.h"
+
+namespace graph {
+
+    // shortest path (fewest edges) from s to t with bidirectional BFS, or an empty vector if t is not reachable
+    // The searches from s and t stop as soon as they meet. Pass the same workspace to many queries to avoid
+    // allocating and resetting per-vertex arrays for every query.
+    inline std::vector<int> shortestPath(const Graph& g, const int s, const int t, BidirectionalBfsWorkspace& workspace) {
+        const auto adjacent = [&g](const int v) { return g.adj(v); };
+        return ::internal::bidirectionalBfsPath(g.V(), s, t, adjacent, adjacent, workspace);
+    }
+
+    // shortest path (fewest edges) from s to t with bidirectional BFS, or an empty vector if t is not reachable
+    inline std::vector<int> shortestPath(const Graph& g, const int s, const int t) {
+        BidirectionalBfsWorkspace workspace{};
+        return shortestPath(g, s, t, workspace);
+    }
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_GRAPHSHORTESTPATH_H
@@ -0,0 +1,72 @@
+#ifndef GRAPHS_CPP_INCREMENTALCONNECTIVITY_H
+#define GRAPHS_CPP_INCREMENTALCONNECTIVITY_H
+
+#include "Graph.h"
+#include "DisjointSets.h"
+
+namespace graph {
+
+    // Graph with adjacency lists which keeps its connected components up to date while vertices and edges are added
+    // Every addEdge additionally unites the sets of both vertices in a DisjointSets, so connectivity queries take
+    // O(log V) time instead of recomputing ConnectedComponents after each change.
+    // Queries do not compress paths, so several threads may query concurrently while the graph is not modified.
+    // Edges cannot be removed, as union-find cannot split sets.
+    class IncrementalConnectivityGraph : public AdjacencyListGraph {
+    public:
+        // create graph with V vertices
+        explicit IncrementalConnectivityGraph(const int V) : AdjacencyListGraph(V), sets(V) {}
+
+        // create graph with input stream
+        explicit IncrementalConnectivityGraph(std::istream& is) : AdjacencyListGraph(is), sets(V()) {
+            uniteAllEdges();
+        }
+
+        // create graph from an edge list (see EdgeListLoader.h)
+        explicit IncrementalConnectivityGraph(const EdgeList& edgeList) : AdjacencyListGraph(edgeList), sets(V()) {
+            uniteAllEdges();
+        }
+
+        // add edge v-w to graph and connect the components of v and w
+        void addEdge(const int v, const int w) override {
+            AdjacencyListGraph::addEdge(v, w);
+            sets.setUnion(v, w);
+        }
+
+        // add a vertex without edges (i.e. a new component) to graph and return it
+        int addVertex() override {
+            sets.addElement();
+            return AdjacencyListGraph::addVertex();
+        }
+
+        // whether v and w are connected
+        [[nodiscard]] bool connected(const int v, const int w) const {
+            if (!vertexValid(v) || !vertexValid(w)) throw std::invalid_argument("Invalid vertex");
+            return sets.connectedWithoutCompression(v, w);
+        }
+
+        // number of connected components
+        [[nodiscard]] int numComponents() const {
+            return sets.numSets();
+        }
+
+        // number of vertices in the component of v
+        [[nodiscard]] int componentSize(const int v) const {
+            if (!vertexValid(v)) throw std::invalid_argument("Invalid vertex");
+            return sets.setSizeWithoutCompression(v);
+        }
+
+    private:
+        DisjointSets sets; // components of the vertices
+
+        void uniteAllEdges() {
+            for (int v = 0; v < V(); ++v) {
+                for (const int w : adjUnchecked(v)) {
+                    if (w > v) sets.setUnion(v, w);
+                }
+            }
+        }
+    };
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_INCREMENTALCONNECTIVITY_H
@@ -0,0 +1,86 @@
+#ifndef GRAPHS_CPP_MAPPEDGRAPH_H
+#define GRAPHS_CPP_MAPPEDGRAPH_H
+
+#include "Graph.h"
+#include "GraphSnapshot.h"
+
+namespace graph {
+
+    // write binary snapshot of g to path (see GraphSnapshot.h), which can be opened with MappedGraph
+    inline void writeSnapshot(const Graph& g, const std::string& path) {
+        writeSnapshotFile(path, SnapshotType::Graph, g.V(), g.E(),
+                          [&](const int v) { return g.adj(v).size(); },
+                          [&](const int v, const auto& write) {
+                              for (const int w : g.adj(v)) write(static_cast<int32_t>(w));
+                          });
+    }
+
+    // Immutable graph which uses a memory-mapped snapshot file directly (zero-copy)
+    // Opening maps the file and checks its header and row offsets in O(V), but not the adjacencies. Call validate()
+    // before using a file which may be corrupt, as invalid vertices in it lead to undefined behavior.
+    // The pages are loaded on first access and shared with all other processes which map the same file.
+    class MappedGraph : public Graph {
+    public:
+        // map snapshot at path (created with writeSnapshot)
+        explicit MappedGraph(const std::string& path) : file(path, SnapshotType::Graph),
+                                                        offsets(file.rowOffsets()), targets(file.entries<int>()) {}
+
+        // mapped graphs cannot be changed
+        void addEdge(int, int) override {
+            throw std::logic_error("MappedGraph is immutable");
+        }
+
+        // get vertices adjacent to v
+        [[nodiscard]] ArrayView<int> adj(int v) const override {
+            if (!vertexValid(v)) {
+                throw std::invalid_argument("Invalid vertex");
+            }
+            return {targets.data() + offsets[v], static_cast<size_t>(offsets[v + 1] - offsets[v])};
+        }
+
+        // get vertices adjacent to v without bounds check (non-virtual, see GraphConcept.h)
+        [[nodiscard]] ArrayView<int> adjUnchecked(int v) const {
+            return {targets.data() + offsets[v], static_cast<size_t>(offsets[v + 1] - offsets[v])};
+        }
+
+        // number of vertices
+        [[nodiscard]] int V() const override {
+            return file.V();
+        }
+
+        // number of edges
+        [[nodiscard]] int E() const override {
+            return file.E();
+        }
+
+        // create string representation
+        [[nodiscard]] std::string toString() const override {
+            std::stringstream ss;
+            ss << "[Graph with " << V() << " vertices and " << E() << " edges]\n";
+            for (int i = 0; i < V(); ++i) {
+                for (const auto edge : adj(i)) {
+                    ss << i << "-" << edge << "\n";
+                }
+            }
+            return ss.str();
+        }
+
+        // whether a vertex exists
+        [[nodiscard]] bool vertexValid(int v) const override {
+            return v >= 0 && v < file.V();
+        }
+
+        // check the whole file for invalid offsets or vertices in O(V+E)
+        void validate() const {
+            file.validateRows();
+        }
+
+    private:
+        SnapshotFile file; // mapped snapshot
+        ArrayView<uint64_t> offsets; // start of each row in targets (V+1 elements)
+        ArrayView<int> targets; // adjacencies of all vertices (each edge v-w is saved as v->w and w->v)
+    };
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_MAPPEDGRAPH_H
@@ -0,0 +1,165 @@
+#ifndef GRAPHS_CPP_MULTISOURCEBFS_H
+#define GRAPHS_CPP_MULTISOURCEBFS_H
+
+#include <array>
+#include <cstdint>
+#include "Graph.h"
+#include "Bitmap.h"
+
+// Bit-parallel multi-source breadth-first search (MS-BFS, Then et al., "The More the Merrier: Efficient
+// Multi-Source Graph Traversal", 2014)
+// A batch of up to 64*Words sources is traversed at once: every vertex keeps one bit per source in its seen/visit
+// masks, so one sweep over the adjacencies advances the BFS of all sources of the batch by one level.
+namespace graph::multi_source_bfs {
+
+    // Set of sources of one batch with one bit per source (Words=4 gives 256 sources, which compilers can map to
+    // AVX2 registers when compiling with -mavx2)
+    template<size_t Words>
+    struct SourceMask {
+        std::array<uint64_t, Words> words{};
+
+        [[nodiscard]] bool any() const {
+            uint64_t result = 0;
+            for (const auto word : words) result |= word;
+            return result != 0;
+        }
+
+        // set bit of source i
+        void set(const size_t i) {
+            words[i / 64] |= uint64_t{1} << (i % 64);
+        }
+
+        // call fn(i) for every source i in this mask
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            for (size_t w = 0; w < Words; ++w) {
+                uint64_t word = words[w];
+                while (word != 0) {
+                    fn(w * 64 + Bitmap::countTrailingZeros(word));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        // this |= (a & ~b), returns whether any new bits came from a
+        bool orAndNot(const SourceMask& a, const SourceMask& b) {
+            uint64_t added = 0;
+            for (size_t w = 0; w < Words; ++w) {
+                const uint64_t d = a.words[w] & ~b.words[w];
+                words[w] |= d;
+                added |= d;
+            }
+            return added != 0;
+        }
+
+        SourceMask& operator|=(const SourceMask& rhs) {
+            for (size_t w = 0; w < Words; ++w) words[w] |= rhs.words[w];
+            return *this;
+        }
+    };
+
+    // Statistics of the BFS from one source, calculated without storing its distances
+    struct SourceStatistics {
+        int source = -1; // start vertex
+        int reached = 0; // number of reachable vertices (including source)
+        long long distanceSum = 0; // sum of distances to all reachable vertices
+        int eccentricity = 0; // largest distance to a reachable vertex
+
+        // closeness centrality within the reachable part of the graph: (reached-1) / distanceSum
+        [[nodiscard]] double closeness() const {
+            return distanceSum == 0 ? 0.0 : static_cast<double>(reached - 1) / static_cast<double>(distanceSum);
+        }
+    };
+
+    namespace internal {
+        // run MS-BFS for sources[0] to sources[numSources-1] (numSources <= 64*Words)
+        // and call onVisit(v, mask, level) whenever vertex v is reached by the sources in mask for the first time
+        template<size_t Words, typename OnVisit>
+        void multiSourceBfsBatch(const Graph& g, const int* sources, const size_t numSources, OnVisit&& onVisit) {
+            using Mask = SourceMask<Words>;
+            std::vector<Mask> seen(g.V()), visit(g.V()), visitNext(g.V());
+
+            for (size_t i = 0; i < numSources; ++i) {
+                seen[sources[i]].set(i);
+                visit[sources[i]].set(i);
+            }
+            for (int v = 0; v < g.V(); ++v) {
+                if (visit[v].any()) onVisit(v, visit[v], 0);
+            }
+
+            for (int level = 1; ; ++level) {
+                // (1) propagate visit masks to adjacent vertices which have not been seen by these sources yet
+                for (int v = 0; v < g.V(); ++v) {
+                    if (!visit[v].any()) continue;
+                    for (const int other : g.adj(v)) {
+                        visitNext[other].orAndNot(visit[v], seen[other]);
+                    }
+                }
+                // (2) mark newly reached vertices as seen
+                bool anyNext = false;
+                for (int v = 0; v < g.V(); ++v) {
+                    if (!visitNext[v].any()) continue;
+                    anyNext = true;
+                    seen[v] |= visitNext[v];
+                    onVisit(v, visitNext[v], level);
+                }
+                if (!anyNext) break;
+                visit.swap(visitNext);
+                std::fill(visitNext.begin(), visitNext.end(), Mask{});
+            }
+        }
+
+        // split sources into batches of 64*Words and call
+        // multiSourceBfsBatch(g, first source of batch, size of batch, makeOnVisit(index of first source in batch))
+        template<size_t Words, typename MakeOnVisit>
+        void multiSourceBfs(const Graph& g, const std::vector<int>& sources, MakeOnVisit&& makeOnVisit) {
+            for (const int s : sources) {
+                if (!g.vertexValid(s)) throw std::invalid_argument("Invalid start vertex");
+            }
+            constexpr size_t batchSize = 64 * Words;
+            for (size_t first = 0; first < sources.size(); first += batchSize) {
+                const size_t num = std::min(batchSize, sources.size() - first);
+                multiSourceBfsBatch<Words>(g, sources.data() + first, num, makeOnVisit(first));
+            }
+        }
+    } // namespace internal
+
+    // distances from every source to all vertices (-1 for unreachable vertices)
+    // result[i][v] is the distance from sources[i] to v
+    template<size_t Words = 1>
+    std::vector<std::vector<int>> distancesFromSources(const Graph& g, const std::vector<int>& sources) {
+        std::vector<std::vector<int>> result(sources.size());
+        internal::multiSourceBfs<Words>(g, sources, [&](const size_t first) {
+            for (size_t i = first; i < std::min(sources.size(), first + 64 * Words); ++i) {
+                result[i].assign(g.V(), -1);
+            }
+            return [&result, first](const int v, const SourceMask<Words>& mask, const int level) {
+                mask.forEach([&](const size_t i) { result[first + i][v] = level; });
+            };
+        });
+        return result;
+    }
+
+    // statistics (reachable vertices, closeness, eccentricity) of every source without storing all distances
+    template<size_t Words = 1>
+    std::vector<SourceStatistics> statisticsFromSources(const Graph& g, const std::vector<int>& sources) {
+        std::vector<SourceStatistics> result(sources.size());
+        for (size_t i = 0; i < sources.size(); ++i) {
+            result[i].source = sources[i];
+        }
+        internal::multiSourceBfs<Words>(g, sources, [&](const size_t first) {
+            return [&result, first](const int, const SourceMask<Words>& mask, const int level) {
+                mask.forEach([&](const size_t i) {
+                    auto& stats = result[first + i];
+                    ++stats.reached;
+                    stats.distanceSum += level;
+                    stats.eccentricity = level; // levels are increasing
+                });
+            };
+        });
+        return result;
+    }
+
+} // namespace graph::multi_source_bfs
+
+#endif //GRAPHS_CPP_MULTISOURCEBFS_H
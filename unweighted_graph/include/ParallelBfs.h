@@ -0,0 +1,92 @@
+#ifndef GRAPHS_CPP_PARALLELBFS_H
+#define GRAPHS_CPP_PARALLELBFS_H
+
+#include <atomic>
+#include <cstdint>
+#include "Graph.h"
+#include "Parallel.h"
+
+namespace graph::find_paths_to_all {
+
+    // Multi-threaded level-synchronous breadth-first search from vertex start to all reachable vertices
+    // All threads expand chunks of the current frontier into thread-local next frontiers. A vertex is claimed by
+    // atomically setting its bit in a visited bitmap, so only the claiming thread writes its distTo and edgeTo.
+    // Distances equal those of fromVertexToAllBfs, but the chosen parents may differ.
+    // numThreads: number of threads to use (0: std::thread::hardware_concurrency())
+    inline PathsFromVertexResult fromVertexToAllBfsParallel(const Graph& g, const int start,
+                                                            const unsigned numThreads = 0) {
+        if (!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
+        const unsigned threads = resolveNumThreads(numThreads);
+
+        std::vector<int> distTo(g.V(), -1); // number of steps from start to vertex
+        std::vector<int> edgeTo(g.V(), -1); // from which vertex another vertex was visited from the first time
+        std::vector<std::atomic<uint64_t>> visited((static_cast<size_t>(g.V()) + 63) / 64); // one bit per vertex
+        for (auto& word : visited) word.store(0, std::memory_order_relaxed);
+
+        // claim vertex v, i.e. return true for exactly one caller
+        const auto claim = [&visited](const int v) {
+            auto& word = visited[v / 64];
+            const uint64_t bit = uint64_t{1} << (v % 64);
+            if (word.load(std::memory_order_relaxed) & bit) return false; // cheap check first
+            return (word.fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+        };
+
+        std::vector<int> frontier{start}, next{};
+        claim(start);
+        distTo[start] = 0;
+
+        std::vector<std::vector<int>> localNext(threads); // next frontier found by each thread
+        std::vector<size_t> localOffsets(threads + 1, 0); // where the local next frontiers are copied to in next
+        ChunkedRange range(frontier.size(), 64);
+        Barrier barrier(threads);
+
+        runOnThreads(threads, [&](const unsigned threadId) {
+            auto& local = localNext[threadId];
+            while (true) {
+                // (1) expand chunks of the frontier
+                local.clear();
+                size_t chunkBegin, chunkEnd;
+                while (range.nextChunk(chunkBegin, chunkEnd)) {
+                    for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                        const int v = frontier[i];
+                        for (const int other : g.adj(v)) {
+                            if (claim(other)) {
+                                distTo[other] = distTo[v] + 1;
+                                edgeTo[other] = v;
+                                local.push_back(other);
+                            }
+                        }
+                    }
+                }
+                barrier.wait();
+
+                // (2) calculate where each thread puts its part of the next frontier
+                if (threadId == 0) {
+                    for (unsigned t = 0; t < threads; ++t) {
+                        localOffsets[t + 1] = localOffsets[t] + localNext[t].size();
+                    }
+                    next.resize(localOffsets[threads]);
+                }
+                barrier.wait();
+
+                // (3) copy local part into next frontier
+                std::copy(local.begin(), local.end(), next.begin() + static_cast<std::ptrdiff_t>(localOffsets[threadId]));
+                barrier.wait();
+
+                // (4) next level
+                if (threadId == 0) {
+                    frontier.swap(next);
+                    range.reset(frontier.size());
+                }
+                barrier.wait();
+                if (frontier.empty()) break;
+            }
+        });
+
+        // return queryable results
+        return PathsFromVertexResult(start, std::move(distTo), std::move(edgeTo));
+    }
+
+} // namespace graph::find_paths_to_all
+
+#endif //GRAPHS_CPP_PARALLELBFS_H
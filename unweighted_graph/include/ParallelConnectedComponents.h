@@ -0,0 +1,125 @@
+#ifndef GRAPHS_CPP_PARALLELCONNECTEDCOMPONENTS_H
+#define GRAPHS_CPP_PARALLELCONNECTEDCOMPONENTS_H
+
+#include <atomic>
+#include <random>
+#include <unordered_map>
+#include "Graph.h"
+#include "Parallel.h"
+
+namespace graph {
+
+    namespace internal {
+        // Union-find forest for concurrent use: every tree points towards its smallest vertex, and roots are only
+        // changed with compare-and-swap, so concurrent links cannot lose a union
+        class ConcurrentUnionFind {
+        public:
+            explicit ConcurrentUnionFind(const int V) : parent(V) {
+                for (int v = 0; v < V; ++v) parent[v].store(v, std::memory_order_relaxed);
+            }
+
+            // unite the trees of u and v by attaching the root with the larger ID below the other root
+            void link(const int u, const int v) {
+                int p1 = parent[u].load(std::memory_order_relaxed);
+                int p2 = parent[v].load(std::memory_order_relaxed);
+                while (p1 != p2) {
+                    const int high = std::max(p1, p2);
+                    const int low = std::min(p1, p2);
+                    int expected = high;
+                    if (parent[high].compare_exchange_strong(expected, low, std::memory_order_relaxed) ||
+                        expected == low) {
+                        break; // linked now or by another thread
+                    }
+                    // high is no root (anymore): continue one step closer to the roots
+                    p1 = parent[expected].load(std::memory_order_relaxed);
+                    p2 = parent[low].load(std::memory_order_relaxed);
+                }
+            }
+
+            // let v point to its root directly (safe while no links happen concurrently)
+            void compress(const int v) {
+                int p = parent[v].load(std::memory_order_relaxed);
+                while (p != parent[p].load(std::memory_order_relaxed)) {
+                    p = parent[p].load(std::memory_order_relaxed);
+                }
+                parent[v].store(p, std::memory_order_relaxed);
+            }
+
+            // current parent of v (its root after compress(v))
+            [[nodiscard]] int operator[](const int v) const {
+                return parent[v].load(std::memory_order_relaxed);
+            }
+
+        private:
+            std::vector<std::atomic<int>> parent;
+        };
+    } // namespace internal
+
+    // Multi-threaded connected components with the Afforest algorithm (Sutton et al., 2018) on numThreads threads
+    // (0: default number of threads)
+    // (1) Link every vertex with its first neighborRounds neighbors only. This usually connects most vertices of the
+    //     largest component already.
+    // (2) Find the largest intermediate component by sampling and skip its vertices: the remaining edges of all other
+    //     vertices are linked. As the graph stores every edge in both directions, edges into the largest component
+    //     are still seen from their other endpoint.
+    // Components are numbered like by ConnectedComponents(g), i.e. the results are the same.
+    template<typename G, EnableIfGraphLike<G> = 0>
+    ConnectedComponents connectedComponentsParallel(const G& g, const unsigned numThreads = 0) {
+        constexpr size_t neighborRounds = 2;
+        constexpr int numSamples = 1024;
+        constexpr size_t chunk = 1024;
+        const int V = g.V();
+        internal::ConcurrentUnionFind forest(V);
+        const auto compressAll = [&] {
+            parallelFor(0, V, numThreads, [&](const size_t v, unsigned) { forest.compress(static_cast<int>(v)); }, chunk);
+        };
+
+        // (1) sample edges: r-th neighbor of every vertex (iterated, as adjacencies may be decoded on the fly)
+        for (size_t r = 0; r < neighborRounds; ++r) {
+            parallelFor(0, V, numThreads, [&](const size_t v, unsigned) {
+                size_t i = 0;
+                for (const int w : uncheckedAdj(g, static_cast<int>(v))) {
+                    if (i++ == r) {
+                        forest.link(static_cast<int>(v), w);
+                        break;
+                    }
+                }
+            }, chunk);
+            compressAll();
+        }
+
+        // (2) most frequent root among random vertices is probably the one of the largest component
+        int largest = -1;
+        if (V > 0) {
+            std::mt19937 gen(1234); // NOLINT
+            std::uniform_int_distribution<int> vertexDist(0, V - 1);
+            std::unordered_map<int, int> frequency{};
+            int maxFrequency = 0;
+            for (int i = 0; i < numSamples; ++i) {
+                const int root = forest[vertexDist(gen)];
+                const int num = ++frequency[root];
+                if (num > maxFrequency) {
+                    maxFrequency = num;
+                    largest = root;
+                }
+            }
+        }
+
+        // (3) link remaining edges of all vertices outside of the largest component
+        parallelFor(0, V, numThreads, [&](const size_t v, unsigned) {
+            if (forest[static_cast<int>(v)] == largest) return;
+            size_t i = 0;
+            for (const int w : uncheckedAdj(g, static_cast<int>(v))) {
+                if (i++ >= neighborRounds) forest.link(static_cast<int>(v), w);
+            }
+        }, chunk);
+        compressAll();
+
+        std::vector<int> label(V);
+        for (int v = 0; v < V; ++v) label[v] = forest[v];
+        return ConnectedComponents::fromLabels(label);
+    }
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_PARALLELCONNECTEDCOMPONENTS_H
@@ -0,0 +1,231 @@
+#ifndef GRAPHS_CPP_TRAVERSALWORKSPACE_H
+#define GRAPHS_CPP_TRAVERSALWORKSPACE_H
+
+#include <cstdint>
+#include <limits>
+#include "Graph.h"
+
+namespace graph::find_paths_to_all {
+
+    // Memory for traversals which can be reused across searches
+    // Every vertex carries the number (epoch) of the search which last visited it, so starting a new search does not
+    // need to reset distTo/edgeTo of all vertices: only vertices stamped with the current epoch count as visited.
+    class TraversalWorkspace {
+    public:
+        // create workspace for graphs with up to V vertices (grows automatically for larger graphs)
+        explicit TraversalWorkspace(const int V = 0) : stamp(V, 0), distTo(V, -1), edgeTo(V, -1) {}
+
+        // start a new search on a graph with V vertices, which invalidates all views of the previous search
+        // O(1) except when the workspace has to grow or (every 2^32-1 searches) the epoch wraps around
+        void reset(const int V) {
+            if (static_cast<size_t>(V) > stamp.size()) {
+                stamp.resize(V, 0);
+                distTo.resize(V, -1);
+                edgeTo.resize(V, -1);
+            }
+            if (epoch == std::numeric_limits<uint32_t>::max()) {
+                // all stamps could be from a search with the same epoch -> clear once
+                std::fill(stamp.begin(), stamp.end(), 0);
+                epoch = 0;
+            }
+            ++epoch;
+            numV = V;
+            touchedVertices.clear();
+        }
+
+        // whether v was visited in the current search
+        [[nodiscard]] bool visited(const int v) const {
+            return stamp[v] == epoch;
+        }
+
+        // mark v as visited in the current search
+        void visit(const int v, const int distance, const int from) {
+            stamp[v] = epoch;
+            distTo[v] = distance;
+            edgeTo[v] = from;
+            touchedVertices.push_back(v);
+        }
+
+        // number of steps from start to v in the current search (-1 if not visited)
+        [[nodiscard]] int distanceTo(const int v) const {
+            return visited(v) ? distTo[v] : -1;
+        }
+
+        // from which vertex v was visited the first time in the current search (-1 for start or not visited)
+        [[nodiscard]] int parentOf(const int v) const {
+            return visited(v) ? edgeTo[v] : -1;
+        }
+
+        // vertices visited in the current search in the order of their visit
+        [[nodiscard]] const std::vector<int>& touched() const {
+            return touchedVertices;
+        }
+
+        // number of the current search
+        [[nodiscard]] uint32_t currentEpoch() const {
+            return epoch;
+        }
+
+        // number of vertices of the graph of the current search
+        [[nodiscard]] int V() const {
+            return numV;
+        }
+
+        std::vector<std::pair<int, size_t>> stack{}; // reusable stack for iterative DFS
+
+    private:
+        uint32_t epoch = 0; // number of current search
+        int numV = 0; // vertices in graph of current search
+        std::vector<uint32_t> stamp; // epoch of the search which last visited a vertex
+        std::vector<int> distTo; // number of steps from start to vertex (only valid if stamp matches epoch)
+        std::vector<int> edgeTo; // from which vertex another vertex was visited first (only valid if stamp matches)
+        std::vector<int> touchedVertices{}; // vertices visited in the current search
+    };
+
+    // Result of a search which views into a TraversalWorkspace instead of copying it
+    // Only valid until the next search with the same workspace (queries throw afterwards).
+    class PathsFromVertexView {
+    public:
+        PathsFromVertexView(const int _start, const TraversalWorkspace& _workspace) :
+                start(_start), workspace(_workspace), epoch(_workspace.currentEpoch()) {}
+
+        // from which vertex the search was started
+        [[nodiscard]] int from() const {
+            return start;
+        }
+
+        // whether a path from start to v exists
+        [[nodiscard]] bool hasPathTo(const int v) const {
+            return distanceTo(v) != -1;
+        }
+
+        // the saved path from start to v or an empty result
+        [[nodiscard]] std::vector<int> pathTo(const int v) const {
+            if (!hasPathTo(v)) {
+                return {};
+            }
+
+            // build path in the reverse direction
+            std::vector<int> path{v};
+            for (int prev = workspace.parentOf(v); prev != -1; prev = workspace.parentOf(prev)) {
+                path.push_back(prev);
+            }
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        [[nodiscard]] int distanceTo(const int v) const {
+            checkValid();
+            if (v < 0 || v >= workspace.V()) {
+                return -1;
+            }
+            return workspace.distanceTo(v);
+        }
+
+        // all reachable vertices in the order of their visit
+        [[nodiscard]] const std::vector<int>& reachable() const {
+            checkValid();
+            return workspace.touched();
+        }
+
+        // copy into a PathsFromVertexResult which stays valid after the next search (O(V))
+        [[nodiscard]] PathsFromVertexResult toResult() const {
+            checkValid();
+            std::vector<int> distTo(workspace.V(), -1);
+            std::vector<int> edgeTo(workspace.V(), -1);
+            for (const int v : workspace.touched()) {
+                distTo[v] = workspace.distanceTo(v);
+                edgeTo[v] = workspace.parentOf(v);
+            }
+            return PathsFromVertexResult(start, std::move(distTo), std::move(edgeTo));
+        }
+
+    private:
+        const int start; // from which vertex the search started
+        const TraversalWorkspace& workspace; // where the results are saved
+        const uint32_t epoch; // number of search in workspace
+
+        // throw if the workspace was used for another search in the meantime
+        void checkValid() const {
+            if (epoch != workspace.currentEpoch()) {
+                throw std::logic_error("Workspace was reused since this search");
+            }
+        }
+    };
+
+    // Depth-first search from vertex start to all reachable vertices without recursion, using workspace
+    inline PathsFromVertexView fromVertexToAllDfsNoRec(const Graph& g, const int start, TraversalWorkspace& workspace) {
+        if (!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
+        workspace.reset(g.V());
+
+        workspace.visit(start, 0, -1);
+        auto& stack = workspace.stack; // vertex ID and index of next adjacent vertex to look at
+        stack.clear();
+        stack.emplace_back(start, 0);
+        while (!stack.empty()) {
+            const auto [v, adjIndexStart] = stack.back();
+            stack.pop_back();
+
+            const auto adjacent = g.adj(v);
+            for (size_t otherIdx = adjIndexStart; otherIdx < adjacent.size(); ++otherIdx) {
+                const int other = adjacent[otherIdx];
+                if (!workspace.visited(other)) {
+                    // continue with other and save where to continue with v afterwards
+                    stack.emplace_back(v, otherIdx + 1);
+                    workspace.visit(other, workspace.distanceTo(v) + 1, v);
+                    stack.emplace_back(other, 0);
+                    break;
+                }
+            }
+        }
+
+        return PathsFromVertexView(start, workspace);
+    }
+
+    namespace internal {
+        // Recursive function for depth first search to all vertices from v, using workspace
+        inline void fromVertexToAllDfsRec(const Graph& g, const int v, TraversalWorkspace& workspace) { // NOLINT
+            for (const int other : g.adj(v)) {
+                if (!workspace.visited(other)) {
+                    workspace.visit(other, workspace.distanceTo(v) + 1, v);
+                    fromVertexToAllDfsRec(g, other, workspace);
+                }
+            }
+        }
+    }
+
+    // Depth-first search from vertex start to all reachable vertices, using workspace
+    inline PathsFromVertexView fromVertexToAllDfs(const Graph& g, const int start, TraversalWorkspace& workspace) {
+        if (!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
+        workspace.reset(g.V());
+
+        workspace.visit(start, 0, -1);
+        internal::fromVertexToAllDfsRec(g, start, workspace);
+
+        return PathsFromVertexView(start, workspace);
+    }
+
+    // Breadth-first search from vertex start to all reachable vertices, using workspace
+    inline PathsFromVertexView fromVertexToAllBfs(const Graph& g, const int start, TraversalWorkspace& workspace) {
+        if (!g.vertexValid(start)) throw std::invalid_argument("Invalid start vertex");
+        workspace.reset(g.V());
+
+        // the visited vertices in order of their visit are the BFS queue: elements before head were already removed
+        const auto& queue = workspace.touched();
+        workspace.visit(start, 0, -1);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const int v = queue[head];
+            const int nextDistance = workspace.distanceTo(v) + 1;
+            for (const int other : g.adj(v)) {
+                if (!workspace.visited(other)) {
+                    workspace.visit(other, nextDistance, v);
+                }
+            }
+        }
+
+        return PathsFromVertexView(start, workspace);
+    }
+
+} // namespace graph::find_paths_to_all
+
+#endif //GRAPHS_CPP_TRAVERSALWORKSPACE_H
@@ -0,0 +1,208 @@
+#ifndef GRAPHS_CPP_TRIANGLECOUNTING_H
+#define GRAPHS_CPP_TRIANGLECOUNTING_H
+
+#include <atomic>
+#include <cstdint>
+#include "Graph.h"
+#include "Parallel.h"
+#include "SortedIntersection.h"
+
+namespace graph {
+
+    namespace internal {
+        // Graph where every edge only points from the vertex with lower (degree, ID) rank to the other one
+        // Vertices are renamed to their ranks and rows are sorted without duplicates or self-loops, so every
+        // triangle u<v<w is found exactly once as w in higher(u) and higher(v) for the edge u->v.
+        // As high-degree vertices come last, their long rows are only intersected with few other rows.
+        class DegreeOrientedGraph {
+        public:
+            DegreeOrientedGraph(const Graph& g, const unsigned numThreads) : rankOf(g.V()), vertexOf(g.V()),
+                                                                            offsets(static_cast<size_t>(g.V()) + 1, 0),
+                                                                            lengths(g.V(), 0) {
+                const int V = g.V();
+                // (1) rank by degree with counting sort
+                int maxDegree = 0;
+                for (int v = 0; v < V; ++v) maxDegree = std::max(maxDegree, static_cast<int>(g.adj(v).size()));
+                std::vector<int> start(static_cast<size_t>(maxDegree) + 2, 0);
+                for (int v = 0; v < V; ++v) ++start[g.adj(v).size() + 1];
+                for (int d = 0; d <= maxDegree; ++d) start[d + 1] += start[d];
+                for (int v = 0; v < V; ++v) {
+                    const int rank = start[g.adj(v).size()]++;
+                    rankOf[v] = rank;
+                    vertexOf[rank] = v;
+                }
+
+                // (2) reserve space for all higher neighbors of each rank
+                for (int r = 0; r < V; ++r) {
+                    size_t num = 0;
+                    for (const int w : g.adj(vertexOf[r])) {
+                        if (rankOf[w] > r) ++num;
+                    }
+                    offsets[r + 1] = offsets[r] + num;
+                }
+
+                // (3) fill, sort and deduplicate rows in parallel
+                targets.resize(offsets.back());
+                parallelFor(0, V, numThreads, [&](const size_t r, unsigned) {
+                    auto pos = targets.begin() + static_cast<std::ptrdiff_t>(offsets[r]);
+                    const auto rowBegin = pos;
+                    for (const int w : g.adj(vertexOf[r])) {
+                        if (rankOf[w] > static_cast<int>(r)) *pos++ = rankOf[w];
+                    }
+                    std::sort(rowBegin, pos);
+                    lengths[r] = static_cast<size_t>(std::unique(rowBegin, pos) - rowBegin);
+                }, 64);
+            }
+
+            // number of vertices
+            [[nodiscard]] int V() const {
+                return static_cast<int>(lengths.size());
+            }
+
+            // higher-ranked neighbors of rank r (sorted ascending)
+            [[nodiscard]] ArrayView<int> higher(const int r) const {
+                return {targets.data() + offsets[r], lengths[r]};
+            }
+
+            // original vertex of rank r
+            [[nodiscard]] int vertex(const int r) const {
+                return vertexOf[r];
+            }
+
+        private:
+            std::vector<int> rankOf; // rank of each original vertex
+            std::vector<int> vertexOf; // original vertex of each rank
+            std::vector<size_t> offsets; // start of the row of each rank in targets
+            std::vector<size_t> lengths; // number of distinct higher neighbors of each rank
+            std::vector<int> targets; // higher neighbors of all ranks
+        };
+    } // namespace internal
+
+    // number of triangles in g on numThreads threads (0: default number of threads)
+    // self-loops and parallel edges are ignored
+    inline uint64_t countTriangles(const Graph& g, const unsigned numThreads = 0) {
+        const internal::DegreeOrientedGraph oriented(g, numThreads);
+        struct alignas(64) PaddedCount {
+            uint64_t value = 0;
+        };
+        std::vector<PaddedCount> counts(resolveNumThreads(numThreads));
+        parallelFor(0, oriented.V(), numThreads, [&](const size_t u, const unsigned threadId) {
+            const auto higherU = oriented.higher(static_cast<int>(u));
+            uint64_t num = 0;
+            for (const int v : higherU) {
+                num += intersectionSize(higherU, oriented.higher(v));
+            }
+            counts[threadId].value += num;
+        }, 64);
+        uint64_t total = 0;
+        for (const auto& count : counts) total += count.value;
+        return total;
+    }
+
+    // Triangles at every vertex of a graph and the clustering coefficients which follow from them
+    // (https://en.wikipedia.org/wiki/Clustering_coefficient), counted on numThreads threads (0: default)
+    // Self-loops and parallel edges are ignored, i.e. the degree of a vertex is its number of distinct neighbors.
+    class Triangles {
+    public:
+        explicit Triangles(const Graph& g, const unsigned numThreads = 0) :
+                perVertex(g.V(), 0), distinctDegree(g.V(), 0) {
+            const internal::DegreeOrientedGraph oriented(g, numThreads);
+            const int V = oriented.V();
+            std::vector<std::atomic<uint64_t>> atVertex(V); // triangles per rank
+            std::vector<std::atomic<int>> lowerDegree(V); // number of distinct lower-ranked neighbors per rank
+            parallelFor(0, V, numThreads, [&](const size_t u, unsigned) {
+                const auto higherU = oriented.higher(static_cast<int>(u));
+                uint64_t atU = 0;
+                for (const int v : higherU) {
+                    lowerDegree[v].fetch_add(1, std::memory_order_relaxed);
+                    uint64_t atEdge = 0;
+                    forEachCommon(higherU, oriented.higher(v), [&](const int w) {
+                        atVertex[w].fetch_add(1, std::memory_order_relaxed);
+                        ++atEdge;
+                    });
+                    if (atEdge > 0) atVertex[v].fetch_add(atEdge, std::memory_order_relaxed);
+                    atU += atEdge;
+                }
+                atVertex[u].fetch_add(atU, std::memory_order_relaxed);
+            }, 64);
+
+            for (int r = 0; r < V; ++r) {
+                const int v = oriented.vertex(r);
+                perVertex[v] = atVertex[r].load(std::memory_order_relaxed);
+                distinctDegree[v] = static_cast<int>(oriented.higher(r).size()) +
+                                    lowerDegree[r].load(std::memory_order_relaxed);
+                total += perVertex[v];
+            }
+            total /= 3; // every triangle is counted at its three vertices
+        }
+
+        // number of triangles in the graph
+        [[nodiscard]] uint64_t count() const {
+            return total;
+        }
+
+        // number of triangles which contain v
+        [[nodiscard]] uint64_t countAt(const int v) const {
+            checkVertex(v);
+            return perVertex[v];
+        }
+
+        // number of triangles at every vertex
+        [[nodiscard]] const std::vector<uint64_t>& countPerVertex() const {
+            return perVertex;
+        }
+
+        // fraction of pairs of neighbors of v which are adjacent (0 for vertices with less than two neighbors)
+        [[nodiscard]] double localClusteringCoefficient(const int v) const {
+            checkVertex(v);
+            const double wedges = numWedges(v);
+            return wedges > 0 ? static_cast<double>(perVertex[v]) / wedges : 0.0;
+        }
+
+        // local clustering coefficients of all vertices
+        [[nodiscard]] std::vector<double> localClusteringCoefficients() const {
+            std::vector<double> result(perVertex.size());
+            for (size_t v = 0; v < perVertex.size(); ++v) {
+                result[v] = localClusteringCoefficient(static_cast<int>(v));
+            }
+            return result;
+        }
+
+        // mean of the local clustering coefficients of all vertices
+        [[nodiscard]] double averageClusteringCoefficient() const {
+            if (perVertex.empty()) return 0.0;
+            double sum = 0.0;
+            for (size_t v = 0; v < perVertex.size(); ++v) {
+                sum += localClusteringCoefficient(static_cast<int>(v));
+            }
+            return sum / static_cast<double>(perVertex.size());
+        }
+
+        // fraction of closed wedges (paths of length two) in the whole graph, also called transitivity
+        [[nodiscard]] double globalClusteringCoefficient() const {
+            double wedges = 0.0;
+            for (size_t v = 0; v < perVertex.size(); ++v) {
+                wedges += numWedges(static_cast<int>(v));
+            }
+            return wedges > 0 ? 3.0 * static_cast<double>(total) / wedges : 0.0;
+        }
+
+    private:
+        std::vector<uint64_t> perVertex; // triangles at each vertex
+        std::vector<int> distinctDegree; // number of distinct neighbors (without v) of each vertex
+        uint64_t total = 0; // triangles in graph
+
+        // number of pairs of distinct neighbors of v
+        [[nodiscard]] double numWedges(const int v) const {
+            const double d = distinctDegree[v];
+            return d * (d - 1) / 2;
+        }
+
+        void checkVertex(const int v) const {
+            if (v < 0 || static_cast<size_t>(v) >= perVertex.size()) throw std::invalid_argument("Invalid vertex");
+        }
+    };
+
+} // namespace graph
+
+#endif //GRAPHS_CPP_TRIANGLECOUNTING_H
@@ -0,0 +1,39 @@
+#ifndef GRAPHS_CPP_TESTHELPERS_H
+#define GRAPHS_CPP_TESTHELPERS_H
+
+#include "gtest/gtest.h"
+#include <random>
+#include "Graph.h"
+
+// create graph with numV vertices and numE random edges
+inline graph::AdjacencyListGraph randomGraphWithEdges(const int numV, const int numE, const unsigned seed = 42) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    graph::AdjacencyListGraph g(numV);
+    for (int i = 0; i < numE; ++i) {
+        g.addEdge(vertexDist(gen), vertexDist(gen));
+    }
+    return g;
+}
+
+// create graph with numV vertices and numV*avgDegree/2 random edges
+inline graph::AdjacencyListGraph randomGraph(const int numV, const int avgDegree, const unsigned seed = 42) {
+    return randomGraphWithEdges(numV, numV * avgDegree / 2, seed);
+}
+
+// check that result has the same distances as a normal BFS and that all paths consist of edges of g
+inline void expectValidBfsResult(const graph::Graph& g, const graph::find_paths_to_all::PathsFromVertexResult& result) {
+    const auto expected = graph::find_paths_to_all::fromVertexToAllBfs(g, result.from());
+    for (int v = 0; v < g.V(); ++v) {
+        ASSERT_EQ(result.distanceTo(v), expected.distanceTo(v));
+        if (!result.hasPathTo(v)) continue;
+        const auto path = result.pathTo(v);
+        ASSERT_EQ(path.size(), static_cast<size_t>(result.distanceTo(v) + 1));
+        for (size_t i = 0; i + 1 < path.size(); ++i) {
+            const auto adjacent = g.adj(path[i]);
+            ASSERT_NE(std::find(adjacent.begin(), adjacent.end(), path[i + 1]), adjacent.end());
+        }
+    }
+}
+
+#endif //GRAPHS_CPP_TESTHELPERS_H
@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <sstream>
+#include "CompressedGraph.h"
+#include "CsrGraph.h"
+#include "GraphReordering.h"
+#include "ParallelConnectedComponents.h"
+#include "TestHelpers.h"
+
+static_assert(IsGraphLike<graph::CompressedGraph>::value);
+
+TEST(compressed_graph, same_as_adjacency_list) { // NOLINT
+    std::istringstream iss("5 5 0 1 1 2 3 3 4 0 2 0");
+    const graph::AdjacencyListGraph adjListGraph(iss);
+    const graph::CompressedGraph compressed(adjListGraph);
+    EXPECT_EQ(compressed.V(), 5);
+    EXPECT_EQ(compressed.E(), 5);
+    EXPECT_EQ(compressed.adj(0).toVector(), (std::vector<int>{1, 2, 4}));
+    EXPECT_EQ(compressed.adj(3).toVector(), (std::vector<int>{3, 3}));
+    EXPECT_EQ(compressed.degree(3), 2);
+    EXPECT_TRUE(compressed.hasEdge(4, 0));
+    EXPECT_FALSE(compressed.hasEdge(4, 1));
+    EXPECT_ANY_THROW(static_cast<void>(compressed.adj(5)));
+    EXPECT_ANY_THROW(static_cast<void>(compressed.hasEdge(0, -1)));
+
+    std::istringstream iss2("5 5 0 1 1 2 3 3 4 0 2 0");
+    EXPECT_EQ(graph::CompressedGraph(iss2).toString(), compressed.toString());
+}
+
+TEST(compressed_graph, algorithms) { // NOLINT
+    for (unsigned seed = 0; seed < 3; ++seed) {
+        const auto g = randomGraphWithEdges(2000, 1200 + 600 * static_cast<int>(seed), seed);
+        const graph::CompressedGraph compressed(g);
+
+        const graph::ConnectedComponents cc(g);
+        EXPECT_EQ(graph::ConnectedComponents(compressed).components(), cc.components());
+        EXPECT_EQ(graph::connectedComponentsParallel(compressed, 2).components(), cc.components());
+        EXPECT_EQ(graph::isBipartite(compressed), graph::isBipartite(g));
+
+        const auto expected = graph::find_paths_to_all::fromVertexToAllBfs(g, 0);
+        const auto result = graph::find_paths_to_all::fromVertexToAllBfs(compressed, 0);
+        for (int v = 0; v < g.V(); ++v) {
+            EXPECT_EQ(result.distanceTo(v), expected.distanceTo(v));
+        }
+    }
+}
+
+TEST(compressed_graph, smaller_than_csr_after_reordering) { // NOLINT
+    // grid graph with random vertex IDs
+    const int side = 100;
+    std::vector<int> id(side * side);
+    for (int i = 0; i < side * side; ++i) id[i] = i;
+    std::shuffle(id.begin(), id.end(), std::mt19937(1)); // NOLINT
+    graph::AdjacencyListGraph g(side * side);
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            if (c + 1 < side) g.addEdge(id[r * side + c], id[r * side + c + 1]);
+            if (r + 1 < side) g.addEdge(id[r * side + c], id[(r + 1) * side + c]);
+        }
+    }
+    const auto relabeled = graph::relabel(g, graph::computeVertexOrder(g, VertexOrder::ReverseCuthillMcKee));
+    const graph::CompressedGraph compressed(relabeled);
+    const size_t csrBytes = (static_cast<size_t>(g.V()) + 1) * sizeof(size_t) + 2 * g.E() * sizeof(int);
+    EXPECT_LT(2 * compressed.memoryBytes(), csrBytes);
+    EXPECT_EQ(graph::ConnectedComponents(compressed).count(), 1);
+}
@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+#include "Graph.h"
+#include "CsrGraph.h"
+#include "ParallelConnectedComponents.h"
+#include "TestHelpers.h"
+
+// path 0-1-2-...-(numV-1), too long for recursion over the path
+static graph::CsrGraph longPath(const int numV) {
+    std::vector<int> endpoints{};
+    for (int v = 0; v + 1 < numV; ++v) {
+        endpoints.push_back(v);
+        endpoints.push_back(v + 1);
+    }
+    return graph::CsrGraph(numV, CompressedSparseRows::fromEndpoints(numV, endpoints, true));
+}
+
+TEST(connected_components, long_path_without_recursion) { // NOLINT
+    const auto g = longPath(2000000);
+    const graph::ConnectedComponents cc(g);
+    EXPECT_EQ(cc.count(), 1);
+    EXPECT_TRUE(cc.connected(0, g.V() - 1));
+    EXPECT_TRUE(graph::isBipartite(g));
+    EXPECT_EQ(graph::connectedComponentsParallel(g, 2).count(), 1);
+}
+
+TEST(connected_components, bipartite_odd_cycle) { // NOLINT
+    graph::AdjacencyListGraph g(7);
+    for (int v = 0; v < 4; ++v) g.addEdge(v, v + 1);
+    g.addEdge(5, 6);
+    EXPECT_TRUE(graph::isBipartite(g));
+    g.addEdge(4, 0); // cycle of length 5
+    EXPECT_FALSE(graph::isBipartite(g));
+}
+
+TEST(connected_components, from_labels) { // NOLINT
+    const auto cc = graph::ConnectedComponents::fromLabels({3, 1, 3, 3, 1, 5});
+    EXPECT_EQ(cc.count(), 3);
+    EXPECT_EQ(cc.components(), (std::vector<std::vector<int>>{{0, 2, 3}, {1, 4}, {5}}));
+    EXPECT_ANY_THROW(graph::ConnectedComponents::fromLabels({0, 2}));
+}
+
+TEST(connected_components, parallel_same_as_serial) { // NOLINT
+    // below and above the threshold for a giant component, with isolated vertices and self-loops
+    for (unsigned seed = 0; seed < 6; ++seed) {
+        const auto g = randomGraphWithEdges(5000, 1500 + 1000 * static_cast<int>(seed), seed);
+        const graph::ConnectedComponents serial(g);
+        for (const unsigned threads : {1u, 2u, 4u}) {
+            const auto parallel = graph::connectedComponentsParallel(g, threads);
+            EXPECT_EQ(parallel.count(), serial.count());
+            EXPECT_EQ(parallel.components(), serial.components());
+        }
+    }
+    EXPECT_EQ(graph::connectedComponentsParallel(graph::AdjacencyListGraph(0)).count(), 0);
+}
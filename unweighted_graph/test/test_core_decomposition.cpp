@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include "CoreDecomposition.h"
+#include "TestHelpers.h"
+
+// core numbers by repeatedly removing all vertices with degree < k for k = 1, 2, ...
+static std::vector<int> bruteForceCores(const graph::Graph& g) {
+    std::vector<int> cores(g.V(), 0);
+    for (int k = 1;; ++k) {
+        std::vector<bool> removed(g.V(), false);
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int v = 0; v < g.V(); ++v) {
+                if (removed[v]) continue;
+                int deg = 0;
+                for (const int w : g.adj(v)) {
+                    if (!removed[w]) ++deg;
+                }
+                if (deg < k) {
+                    removed[v] = true;
+                    changed = true;
+                }
+            }
+        }
+        if (std::find(removed.begin(), removed.end(), false) == removed.end()) return cores;
+        for (int v = 0; v < g.V(); ++v) {
+            if (!removed[v]) cores[v] = k;
+        }
+    }
+}
+
+TEST(core_decomposition, small_graph) { // NOLINT
+    // 4-clique 0-1-2-3, path 3-4-5, and isolated vertex 6
+    graph::AdjacencyListGraph g(7);
+    for (int v = 0; v < 4; ++v) {
+        for (int w = v + 1; w < 4; ++w) g.addEdge(v, w);
+    }
+    g.addEdge(3, 4);
+    g.addEdge(4, 5);
+    for (const unsigned threads : {1u, 2u}) {
+        const graph::CoreDecomposition cores(g, threads);
+        EXPECT_EQ(cores.coreNumbers(), (std::vector<int>{3, 3, 3, 3, 1, 1, 0}));
+        EXPECT_EQ(cores.maxCoreNumber(), 3);
+        EXPECT_EQ(cores.kCore(2), (std::vector<int>{0, 1, 2, 3}));
+        EXPECT_EQ(cores.kCoreSize(1), 6);
+        EXPECT_EQ(cores.kCoreSize(4), 0);
+        EXPECT_TRUE(cores.inKCore(4, 1));
+        EXPECT_FALSE(cores.inKCore(4, 2));
+        EXPECT_THROW(static_cast<void>(cores.coreNumber(7)), std::invalid_argument);
+    }
+    EXPECT_EQ(graph::CoreDecomposition(graph::AdjacencyListGraph(0)).maxCoreNumber(), 0);
+}
+
+TEST(core_decomposition, same_as_brute_force) { // NOLINT
+    for (const unsigned seed : {1u, 2u, 3u}) {
+        auto g = randomGraph(300, 2 + 4 * static_cast<int>(seed), seed);
+        g.addEdge(5, 5); // self-loop
+        const auto expected = bruteForceCores(g);
+        EXPECT_EQ(graph::CoreDecomposition(g).coreNumbers(), expected);
+        EXPECT_EQ(graph::CoreDecomposition(g, 4).coreNumbers(), expected);
+        EXPECT_EQ(graph::CoreDecomposition(g, 0).coreNumbers(), expected);
+    }
+}
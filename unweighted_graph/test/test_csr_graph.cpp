@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include <memory>
+#include "CsrGraph.h"
+#include "EdgeListLoader.h"
+
+// graph source of tinyG.txt
+static const char* tinyGCsr = R"(13
+13
+0 5
+4 3
+0 1
+9 12
+6 4
+5 4
+0 2
+11 12
+9 10
+0 6
+7 8
+9 11
+5 3
+)";
+
+TEST(csr_graph, same_as_adjacency_list) { // NOLINT
+    std::istringstream iss1(tinyGCsr);
+    const graph::AdjacencyListGraph adjListGraph(iss1);
+    const graph::CsrGraph fromAdjList(adjListGraph);
+    std::istringstream iss2(tinyGCsr);
+    const graph::CsrGraph fromStream(iss2);
+
+    for (const graph::Graph* pGraph : {static_cast<const graph::Graph*>(&fromAdjList),
+                                       static_cast<const graph::Graph*>(&fromStream)}) {
+        EXPECT_EQ(pGraph->V(), 13);
+        EXPECT_EQ(pGraph->E(), 13);
+        EXPECT_EQ(pGraph->toString(), adjListGraph.toString());
+        for (int v = 0; v < adjListGraph.V(); ++v) {
+            EXPECT_EQ(pGraph->adj(v).toVector(), adjListGraph.adj(v).toVector());
+        }
+        EXPECT_ANY_THROW(pGraph->adj(13));
+        EXPECT_EQ(graph::maxDegree(*pGraph), 4);
+    }
+}
+
+TEST(csr_graph, algorithms) { // NOLINT
+    std::istringstream iss(tinyGCsr);
+    const graph::AdjacencyListGraph adjListGraph(iss);
+    const graph::CsrGraph csrGraph(adjListGraph);
+
+    EXPECT_TRUE(graph::find_paths_to_all::fromVertexToAllBfs(csrGraph, 0) ==
+                graph::find_paths_to_all::fromVertexToAllBfs(adjListGraph, 0));
+    EXPECT_TRUE(graph::find_paths_to_all::fromVertexToAllDfsNoRec(csrGraph, 9) ==
+                graph::find_paths_to_all::fromVertexToAllDfsNoRec(adjListGraph, 9));
+    EXPECT_EQ(graph::ConnectedComponents(csrGraph).components(),
+              graph::ConnectedComponents(adjListGraph).components());
+    EXPECT_FALSE(graph::isBipartite(csrGraph));
+}
+
+TEST(csr_graph, immutable_and_invalid_input) { // NOLINT
+    graph::CsrGraph csrGraph(graph::AdjacencyListGraph(3));
+    EXPECT_THROW(csrGraph.addEdge(0, 1), std::logic_error);
+    EXPECT_TRUE(csrGraph.adj(2).empty());
+
+    std::istringstream badEdge("3 1 0 3");
+    EXPECT_THROW(graph::CsrGraph{badEdge}, std::invalid_argument);
+    std::istringstream missingEdge("3 2 0 1");
+    EXPECT_THROW(graph::CsrGraph{missingEdge}, std::invalid_argument);
+}
+
+TEST(csr_graph, from_edge_list) { // NOLINT
+    std::istringstream iss(tinyGCsr);
+    const graph::AdjacencyListGraph fromStream(iss);
+    const auto edgeList = parseEdgeList(tinyGCsr, false);
+    EXPECT_EQ(graph::AdjacencyListGraph(edgeList).toString(), fromStream.toString());
+    EXPECT_EQ(graph::CsrGraph(edgeList).toString(), fromStream.toString());
+}
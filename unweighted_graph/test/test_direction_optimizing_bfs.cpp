@@ -0,0 +1,33 @@
+#include "gtest/gtest.h"
+#include "DirectionOptimizingBfs.h"
+#include "TestHelpers.h"
+
+using namespace graph::find_paths_to_all;
+
+TEST(direction_optimizing_bfs, small_graph) { // NOLINT
+    graph::AdjacencyListGraph g(6);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(0, 3);
+    g.addEdge(4, 5);
+
+    EXPECT_ANY_THROW(fromVertexToAllBfsDirectionOptimizing(g, 6));
+    // alpha=1/beta=1 switches to bottom-up as early as possible
+    for (const int alpha : {1, 15}) {
+        const auto result = fromVertexToAllBfsDirectionOptimizing(g, 0, alpha, 1);
+        expectValidBfsResult(g, result);
+        EXPECT_FALSE(result.hasPathTo(4));
+        EXPECT_EQ(result.distanceTo(2), 2);
+    }
+}
+
+TEST(direction_optimizing_bfs, random_graphs) { // NOLINT
+    for (const int avgDegree : {1, 4, 32}) {
+        const int numV = 3000;
+        const auto g = randomGraph(numV, avgDegree);
+        for (const int start : {0, 17, numV - 1}) {
+            expectValidBfsResult(g, fromVertexToAllBfsDirectionOptimizing(g, start));
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+#include <random>
+#include "GraphBetweenness.h"
+#include "CsrGraph.h"
+
+// betweenness by definition: sum over pairs s<t of sigma_st(v)/sigma_st with BFS from every vertex
+static std::vector<double> bruteForceBetweenness(const graph::Graph& g) {
+    const int V = g.V();
+    std::vector<std::vector<int>> dist(V, std::vector<int>(V, -1));
+    std::vector<std::vector<double>> sigma(V, std::vector<double>(V, 0.0));
+    for (int s = 0; s < V; ++s) {
+        std::vector<int> queue{s};
+        dist[s][s] = 0;
+        sigma[s][s] = 1;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const int v = queue[head];
+            for (const int w : g.adj(v)) {
+                if (dist[s][w] == -1) {
+                    dist[s][w] = dist[s][v] + 1;
+                    queue.push_back(w);
+                }
+                if (dist[s][w] == dist[s][v] + 1) sigma[s][w] += sigma[s][v];
+            }
+        }
+    }
+    std::vector<double> result(V, 0.0);
+    for (int s = 0; s < V; ++s) {
+        for (int t = s + 1; t < V; ++t) {
+            if (dist[s][t] <= 0) continue;
+            for (int v = 0; v < V; ++v) {
+                if (v == s || v == t || dist[s][v] <= 0 || dist[v][t] <= 0) continue;
+                if (dist[s][v] + dist[v][t] == dist[s][t]) result[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+            }
+        }
+    }
+    return result;
+}
+
+TEST(graph_betweenness, path_and_star) { // NOLINT
+    graph::AdjacencyListGraph path(5);
+    for (int v = 0; v + 1 < 5; ++v) path.addEdge(v, v + 1);
+    EXPECT_EQ(graph::betweennessCentrality(path), (std::vector<double>{0, 3, 4, 3, 0}));
+
+    graph::AdjacencyListGraph star(6);
+    for (int v = 1; v < 6; ++v) star.addEdge(0, v);
+    const auto c = graph::betweennessCentrality(star, 2);
+    EXPECT_DOUBLE_EQ(c[0], 10.0); // all 5*4/2 pairs of leaves
+    for (int v = 1; v < 6; ++v) EXPECT_DOUBLE_EQ(c[v], 0.0);
+
+    EXPECT_TRUE(graph::betweennessCentrality(graph::AdjacencyListGraph(0)).empty());
+}
+
+TEST(graph_betweenness, same_as_definition) { // NOLINT
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> vertexDist(0, 59);
+        graph::AdjacencyListGraph g(60);
+        for (int i = 0; i < 90; ++i) g.addEdge(vertexDist(gen), vertexDist(gen)); // with parallel edges and self-loops
+        const auto expected = bruteForceBetweenness(g);
+        for (const unsigned threads : {1u, 3u}) {
+            const auto result = graph::betweennessCentrality(graph::CsrGraph(g), threads);
+            for (int v = 0; v < g.V(); ++v) EXPECT_NEAR(result[v], expected[v], 1e-9);
+        }
+    }
+}
+
+TEST(graph_betweenness, approximation) { // NOLINT
+    std::mt19937 gen(5); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, 399);
+    graph::AdjacencyListGraph g(400);
+    for (int i = 0; i < 1200; ++i) g.addEdge(vertexDist(gen), vertexDist(gen));
+    const auto exact = graph::betweennessCentrality(g);
+    EXPECT_EQ(graph::betweennessCentrality(g, 3), graph::betweennessCentrality(g, 1)); // same order of summation
+
+    // sampling all sources is exact
+    const auto all = graph::approximateBetweennessCentrality(g, 400, 2);
+    for (int v = 0; v < g.V(); ++v) EXPECT_NEAR(all[v], exact[v], 1e-6);
+
+    // the vertex with the highest betweenness is estimated well from a quarter of the sources
+    const int top = static_cast<int>(std::max_element(exact.begin(), exact.end()) - exact.begin());
+    const auto sampled = graph::approximateBetweennessCentrality(g, 100, 2);
+    EXPECT_NEAR(sampled[top], exact[top], 0.25 * exact[top]);
+    EXPECT_EQ(graph::approximateBetweennessCentrality(g, 100, 1), sampled); // same seed, same sources
+    EXPECT_THROW(graph::approximateBetweennessCentrality(g, 0), std::invalid_argument);
+}
@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "Graph.h"
+#include "CsrGraph.h"
+#include "TestHelpers.h"
+
+static_assert(IsGraphLike<graph::Graph>::value);
+static_assert(IsGraphLike<graph::CsrGraph>::value);
+static_assert(!HasUncheckedAdjacency<graph::Graph>::value);
+static_assert(HasUncheckedAdjacency<graph::AdjacencyListGraph>::value);
+static_assert(HasUncheckedAdjacency<graph::CsrGraph>::value);
+static_assert(!IsGraphLike<int>::value);
+
+TEST(graph_concept, concrete_types_same_as_interface) { // NOLINT
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        const auto adjListGraph = randomGraphWithEdges(300, 250 + 50 * static_cast<int>(seed), seed);
+        const graph::CsrGraph csrGraph(adjListGraph);
+        const graph::Graph& g = adjListGraph;
+
+        const graph::ConnectedComponents cc(g);
+        const graph::ConnectedComponents ccAdjList(adjListGraph);
+        const graph::ConnectedComponents ccCsr(csrGraph);
+        EXPECT_EQ(ccAdjList.components(), cc.components());
+        EXPECT_EQ(ccCsr.components(), cc.components());
+
+        EXPECT_EQ(graph::isBipartite(adjListGraph), graph::isBipartite(g));
+        EXPECT_EQ(graph::isBipartite(csrGraph), graph::isBipartite(g));
+
+        for (const int start : {0, 17, 299}) {
+            const auto result = graph::find_paths_to_all::fromVertexToAllBfs(g, start);
+            EXPECT_EQ(graph::find_paths_to_all::fromVertexToAllBfs(adjListGraph, start), result);
+            EXPECT_EQ(graph::find_paths_to_all::fromVertexToAllBfs(csrGraph, start), result);
+        }
+    }
+}
+
+TEST(graph_concept, bipartite) { // NOLINT
+    graph::AdjacencyListGraph g(6);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(4, 5);
+    EXPECT_TRUE(graph::isBipartite(g));
+    EXPECT_TRUE(graph::isBipartite(graph::CsrGraph(g)));
+    g.addEdge(3, 1);
+    EXPECT_FALSE(graph::isBipartite(g));
+    EXPECT_FALSE(graph::isBipartite(graph::CsrGraph(g)));
+}
@@ -0,0 +1,29 @@
+#include "gtest/gtest.h"
+#include "GraphReordering.h"
+#include "TestHelpers.h"
+
+TEST(graph_reordering, relabel_and_translate_back) { // NOLINT
+    const auto g = randomGraph(300, 4, 11);
+    for (const auto order : {VertexOrder::ReverseCuthillMcKee, VertexOrder::DegreeDescending,
+                             VertexOrder::Bfs, VertexOrder::Dfs}) {
+        const auto permutation = graph::computeVertexOrder(g, order);
+        const auto relabeled = graph::relabel(g, permutation);
+        ASSERT_EQ(relabeled.V(), g.V());
+        ASSERT_EQ(relabeled.E(), g.E());
+        for (int v = 0; v < g.V(); ++v) {
+            const auto adjacent = relabeled.adj(permutation.toNew(v));
+            ASSERT_EQ(adjacent.size(), g.adj(v).size());
+            ASSERT_TRUE(std::is_sorted(adjacent.begin(), adjacent.end()));
+            for (const int w : g.adj(v)) {
+                ASSERT_NE(std::find(adjacent.begin(), adjacent.end(), permutation.toNew(w)), adjacent.end());
+            }
+        }
+
+        // search in relabeled graph, results in original IDs
+        const auto result = graph::find_paths_to_all::fromVertexToAllBfs(relabeled, permutation.toNew(5));
+        const auto translated = graph::find_paths_to_all::toOriginalIds(result, permutation);
+        EXPECT_EQ(translated.from(), 5);
+        expectValidBfsResult(g, translated);
+    }
+    EXPECT_THROW(graph::relabel(g, VertexPermutation::identity(3)), std::invalid_argument);
+}
@@ -0,0 +1,42 @@
+#include "gtest/gtest.h"
+#include "GraphShortestPath.h"
+#include "TestHelpers.h"
+
+// check that path is a path from s to t in g with the length of a shortest path
+static void expectShortestPath(const graph::Graph& g, const int s, const int t, const std::vector<int>& path) {
+    const auto bfs = graph::find_paths_to_all::fromVertexToAllBfs(g, s);
+    if (!bfs.hasPathTo(t)) {
+        EXPECT_TRUE(path.empty());
+        return;
+    }
+    ASSERT_EQ(path.size(), static_cast<size_t>(bfs.distanceTo(t) + 1));
+    EXPECT_EQ(path.front(), s);
+    EXPECT_EQ(path.back(), t);
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        const auto adjacent = g.adj(path[i]);
+        EXPECT_NE(std::find(adjacent.begin(), adjacent.end(), path[i + 1]), adjacent.end());
+    }
+}
+
+TEST(graph_shortest_path, small_graph) { // NOLINT
+    graph::AdjacencyListGraph g(6);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(0, 4);
+    g.addEdge(4, 3);
+
+    EXPECT_EQ(graph::shortestPath(g, 0, 3), (std::vector<int>{0, 4, 3}));
+    EXPECT_EQ(graph::shortestPath(g, 2, 2), (std::vector<int>{2}));
+    EXPECT_TRUE(graph::shortestPath(g, 0, 5).empty());
+    EXPECT_ANY_THROW(graph::shortestPath(g, 0, 6));
+}
+
+TEST(graph_shortest_path, random_graph_with_workspace) { // NOLINT
+    const auto g = randomGraph(3000, 2);
+    BidirectionalBfsWorkspace workspace{};
+    for (int s = 0; s < 60; ++s) {
+        const int t = (s * 97 + 13) % g.V();
+        expectShortestPath(g, s, t, graph::shortestPath(g, s, t, workspace));
+    }
+}
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <sstream>
+#include "IncrementalConnectivity.h"
+#include "Parallel.h"
+
+TEST(incremental_connectivity, basic) { // NOLINT
+    std::istringstream iss("5 2 0 1 3 4");
+    graph::IncrementalConnectivityGraph g(iss);
+    EXPECT_EQ(g.numComponents(), 3);
+    EXPECT_TRUE(g.connected(0, 1));
+    EXPECT_FALSE(g.connected(1, 2));
+    EXPECT_EQ(g.componentSize(3), 2);
+
+    g.addEdge(1, 2);
+    EXPECT_TRUE(g.connected(0, 2));
+    EXPECT_EQ(g.componentSize(0), 3);
+    EXPECT_EQ(g.numComponents(), 2);
+    g.addEdge(2, 2); // self-loop changes nothing
+    EXPECT_EQ(g.numComponents(), 2);
+
+    EXPECT_EQ(g.addVertex(), 5);
+    EXPECT_EQ(g.V(), 6);
+    EXPECT_EQ(g.numComponents(), 3);
+    EXPECT_EQ(g.componentSize(5), 1);
+    g.addEdge(5, 4);
+    EXPECT_TRUE(g.connected(3, 5));
+    EXPECT_EQ(g.E(), 5);
+    EXPECT_ANY_THROW(static_cast<void>(g.connected(0, 6)));
+    EXPECT_ANY_THROW(g.addEdge(0, 6));
+}
+
+TEST(incremental_connectivity, same_as_connected_components) { // NOLINT
+    std::mt19937 gen(42); // NOLINT
+    graph::IncrementalConnectivityGraph g(200);
+    for (int step = 0; step < 300; ++step) {
+        if (step % 10 == 0) g.addVertex();
+        std::uniform_int_distribution<int> vertexDist(0, g.V() - 1);
+        g.addEdge(vertexDist(gen), vertexDist(gen));
+
+        // modifications through the interface update the components as well
+        graph::Graph& asGraph = g;
+        asGraph.addEdge(vertexDist(gen), vertexDist(gen));
+
+        if (step % 50 == 49) {
+            const graph::ConnectedComponents cc(g);
+            ASSERT_EQ(g.numComponents(), cc.count());
+            for (int v = 0; v < g.V(); ++v) {
+                EXPECT_EQ(g.connected(0, v), cc.connected(0, v));
+                EXPECT_EQ(g.componentSize(v), static_cast<int>(cc.components()[cc.id(v)].size()));
+            }
+        }
+    }
+}
+
+TEST(incremental_connectivity, concurrent_queries) { // NOLINT
+    std::mt19937 gen(7); // NOLINT
+    constexpr int V = 300;
+    std::uniform_int_distribution<int> vertexDist(0, V - 1);
+    graph::IncrementalConnectivityGraph g(V);
+    for (int i = 0; i < 200; ++i) g.addEdge(vertexDist(gen), vertexDist(gen));
+    const graph::ConnectedComponents cc(g);
+
+    // const queries do not modify the union-find, so threads may query the same graph
+    const graph::IncrementalConnectivityGraph& queried = g;
+    std::vector<int> mismatches(4, 0);
+    runOnThreads(4, [&](const unsigned threadId) {
+        for (int v = 0; v < V; ++v) {
+            for (int w = 0; w < V; ++w) mismatches[threadId] += queried.connected(v, w) != cc.connected(v, w) ? 1 : 0;
+            const int size = static_cast<int>(cc.components()[cc.id(v)].size());
+            mismatches[threadId] += queried.componentSize(v) != size ? 1 : 0;
+        }
+    });
+    EXPECT_EQ(mismatches, (std::vector<int>(4, 0)));
+}
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+#include "MappedGraph.h"
+#include "CsrGraph.h"
+#include "TestHelpers.h"
+
+TEST(mapped_graph, same_as_original) { // NOLINT
+    graph::AdjacencyListGraph g = randomGraph(200, 4, 3);
+    g.addEdge(7, 7); // self-loop
+    const std::string path = "test_mapped_graph_tmp.bin";
+    graph::writeSnapshot(g, path);
+    {
+        graph::MappedGraph mapped(path);
+        mapped.validate();
+        EXPECT_EQ(mapped.V(), g.V());
+        EXPECT_EQ(mapped.E(), g.E());
+        EXPECT_EQ(mapped.toString(), g.toString());
+        EXPECT_ANY_THROW(static_cast<void>(mapped.adj(200)));
+        EXPECT_THROW(mapped.addEdge(0, 1), std::logic_error);
+
+        // algorithms work on the mapped graph directly
+        expectValidBfsResult(g, graph::find_paths_to_all::fromVertexToAllBfs(mapped, 0));
+
+        // modifiable copy from the snapshot
+        const graph::AdjacencyListGraph copy(SnapshotFile(path, SnapshotType::Graph).toEdgeList());
+        EXPECT_EQ(copy.E(), g.E());
+        EXPECT_EQ(graph::CsrGraph(copy).E(), g.E());
+        for (int v = 0; v < g.V(); ++v) {
+            EXPECT_EQ(copy.adj(v).size(), g.adj(v).size());
+        }
+    }
+    std::remove(path.c_str());
+}
+
+TEST(mapped_graph, invalid_files) { // NOLINT
+    const std::string path = "test_mapped_graph_invalid_tmp.bin";
+    EXPECT_THROW(graph::MappedGraph("does_not_exist.bin"), std::runtime_error);
+
+    std::ofstream(path) << "5 1\n0 1\n"; // text format
+    EXPECT_THROW(graph::MappedGraph{path}, std::runtime_error);
+
+    graph::writeSnapshot(graph::AdjacencyListGraph(3), path);
+    EXPECT_EQ(graph::MappedGraph(path).V(), 3);
+    EXPECT_THROW(SnapshotFile(path, SnapshotType::Digraph), std::runtime_error); // wrong type
+
+    // 0-1, 1-2 with offsets 0, 1, 3, 4 and corrupted header values or offsets
+    graph::AdjacencyListGraph path3(3);
+    path3.addEdge(0, 1);
+    path3.addEdge(1, 2);
+    const auto writeCorrupted = [&](const std::streamoff pos, const uint64_t value) {
+        graph::writeSnapshot(path3, path);
+        std::fstream fs(path, std::ios::in | std::ios::out | std::ios::binary);
+        fs.seekp(pos);
+        fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    writeCorrupted(offsetof(SnapshotHeader, numEntries), uint64_t{1} << 62); // numEntries * 4 wraps around to 0
+    EXPECT_THROW(graph::MappedGraph{path}, std::runtime_error);
+    writeCorrupted(offsetof(SnapshotHeader, entriesPos), ~uint64_t{7}); // entries far behind the end of the file
+    EXPECT_THROW(graph::MappedGraph{path}, std::runtime_error);
+    writeCorrupted(sizeof(SnapshotHeader) + sizeof(uint64_t), 4); // offsets 0, 4, 3, 4
+    EXPECT_THROW(graph::MappedGraph{path}, std::runtime_error);
+    writeCorrupted(sizeof(SnapshotHeader) + sizeof(uint64_t), 1); // unchanged
+    EXPECT_EQ(graph::MappedGraph(path).E(), 2);
+    std::remove(path.c_str());
+}
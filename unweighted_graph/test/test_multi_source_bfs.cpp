@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+#include <numeric>
+#include "MultiSourceBfs.h"
+#include "TestHelpers.h"
+
+using namespace graph::multi_source_bfs;
+
+// compare MS-BFS distances and statistics with one BFS per source
+template<size_t Words>
+void expectSameAsBfs(const graph::Graph& g, const std::vector<int>& sources) {
+    const auto distances = distancesFromSources<Words>(g, sources);
+    const auto statistics = statisticsFromSources<Words>(g, sources);
+    ASSERT_EQ(distances.size(), sources.size());
+    ASSERT_EQ(statistics.size(), sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        const auto bfs = graph::find_paths_to_all::fromVertexToAllBfs(g, sources[i]);
+        SourceStatistics expected{sources[i]};
+        for (int v = 0; v < g.V(); ++v) {
+            ASSERT_EQ(distances[i][v], bfs.distanceTo(v));
+            if (bfs.hasPathTo(v)) {
+                ++expected.reached;
+                expected.distanceSum += bfs.distanceTo(v);
+                expected.eccentricity = std::max(expected.eccentricity, bfs.distanceTo(v));
+            }
+        }
+        EXPECT_EQ(statistics[i].source, expected.source);
+        EXPECT_EQ(statistics[i].reached, expected.reached);
+        EXPECT_EQ(statistics[i].distanceSum, expected.distanceSum);
+        EXPECT_EQ(statistics[i].eccentricity, expected.eccentricity);
+    }
+}
+
+TEST(multi_source_bfs, path_graph) { // NOLINT
+    graph::AdjacencyListGraph g(4);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+
+    const auto stats = statisticsFromSources(g, {0, 1, 1});
+    EXPECT_EQ(stats[0].eccentricity, 3);
+    EXPECT_EQ(stats[1].eccentricity, 2);
+    EXPECT_DOUBLE_EQ(stats[0].closeness(), 3.0 / 6.0);
+    EXPECT_DOUBLE_EQ(stats[2].closeness(), 3.0 / 4.0);
+    EXPECT_ANY_THROW(distancesFromSources(g, {0, 4}));
+    EXPECT_TRUE(distancesFromSources(g, {}).empty());
+}
+
+TEST(multi_source_bfs, random_graph_batches) { // NOLINT
+    const auto g = randomGraph(800, 3);
+    std::vector<int> sources(300); // more sources than fit into one batch
+    std::iota(sources.begin(), sources.end(), 250);
+    expectSameAsBfs<1>(g, sources);
+    expectSameAsBfs<4>(g, sources);
+}
@@ -0,0 +1,26 @@
+#include "gtest/gtest.h"
+#include "ParallelBfs.h"
+#include "TestHelpers.h"
+
+using namespace graph::find_paths_to_all;
+
+TEST(parallel_bfs, small_graph) { // NOLINT
+    graph::AdjacencyListGraph g(5);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(3, 4);
+
+    EXPECT_ANY_THROW(fromVertexToAllBfsParallel(g, -1));
+    const auto result = fromVertexToAllBfsParallel(g, 0, 4);
+    EXPECT_TRUE(result == fromVertexToAllBfs(g, 0)); // only one valid parent per vertex
+    EXPECT_FALSE(result.hasPathTo(3));
+}
+
+TEST(parallel_bfs, random_graphs) { // NOLINT
+    for (const int avgDegree : {1, 3, 20}) {
+        const auto g = randomGraph(5000, avgDegree);
+        for (const unsigned threads : {0u, 1u, 3u, 8u}) {
+            expectValidBfsResult(g, fromVertexToAllBfsParallel(g, 7, threads));
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#include "gtest/gtest.h"
+#include "TraversalWorkspace.h"
+#include "TestHelpers.h"
+
+using namespace graph::find_paths_to_all;
+
+TEST(traversal_workspace, same_as_without_workspace) { // NOLINT
+    const auto g = randomGraph(2000, 2);
+    TraversalWorkspace workspace{};
+    for (const int start : {0, 5, 1999, 5}) {
+        EXPECT_TRUE(fromVertexToAllBfs(g, start, workspace).toResult() == fromVertexToAllBfs(g, start));
+        EXPECT_TRUE(fromVertexToAllDfs(g, start, workspace).toResult() == fromVertexToAllDfs(g, start));
+        EXPECT_TRUE(fromVertexToAllDfsNoRec(g, start, workspace).toResult() == fromVertexToAllDfsNoRec(g, start));
+    }
+}
+
+TEST(traversal_workspace, views) { // NOLINT
+    graph::AdjacencyListGraph g(5);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(3, 4);
+
+    TraversalWorkspace workspace(2); // grows when needed
+    const auto from3 = fromVertexToAllBfs(g, 3, workspace);
+    EXPECT_EQ(from3.from(), 3);
+    EXPECT_EQ(from3.reachable(), (std::vector<int>{3, 4}));
+    EXPECT_FALSE(from3.hasPathTo(0));
+    EXPECT_EQ(from3.distanceTo(7), -1);
+
+    const auto from0 = fromVertexToAllBfs(g, 0, workspace);
+    EXPECT_THROW(static_cast<void>(from3.hasPathTo(4)), std::logic_error); // workspace was reused
+    EXPECT_FALSE(from0.hasPathTo(4)); // vertices visited by the last search are not visited anymore
+    EXPECT_EQ(from0.pathTo(2), (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(from0.distanceTo(2), 2);
+    EXPECT_ANY_THROW(fromVertexToAllDfs(g, 5, workspace));
+}
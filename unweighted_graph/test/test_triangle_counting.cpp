@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+#include <set>
+#include "TriangleCounting.h"
+#include "TestHelpers.h"
+
+// triangles per vertex by checking all triples of distinct neighbors
+static std::vector<uint64_t> bruteForceTriangles(const graph::Graph& g) {
+    std::vector<std::set<int>> neighbors(g.V());
+    for (int v = 0; v < g.V(); ++v) {
+        for (const int w : g.adj(v)) {
+            if (w != v) neighbors[v].insert(w);
+        }
+    }
+    std::vector<uint64_t> result(g.V(), 0);
+    for (int u = 0; u < g.V(); ++u) {
+        for (const int v : neighbors[u]) {
+            for (const int w : neighbors[v]) {
+                if (v < w && neighbors[u].count(w) > 0) ++result[u];
+            }
+        }
+    }
+    return result;
+}
+
+TEST(triangle_counting, complete_graph_and_star) { // NOLINT
+    graph::AdjacencyListGraph complete(5);
+    for (int v = 0; v < 5; ++v) {
+        for (int w = v + 1; w < 5; ++w) complete.addEdge(v, w);
+    }
+    EXPECT_EQ(graph::countTriangles(complete), 10);
+    const graph::Triangles completeTriangles(complete);
+    EXPECT_EQ(completeTriangles.count(), 10);
+    EXPECT_EQ(completeTriangles.countAt(0), 6);
+    EXPECT_DOUBLE_EQ(completeTriangles.localClusteringCoefficient(2), 1.0);
+    EXPECT_DOUBLE_EQ(completeTriangles.averageClusteringCoefficient(), 1.0);
+    EXPECT_DOUBLE_EQ(completeTriangles.globalClusteringCoefficient(), 1.0);
+
+    graph::AdjacencyListGraph star(5);
+    for (int v = 1; v < 5; ++v) star.addEdge(0, v);
+    star.addEdge(1, 2);
+    const graph::Triangles starTriangles(star);
+    EXPECT_EQ(starTriangles.count(), 1);
+    EXPECT_DOUBLE_EQ(starTriangles.localClusteringCoefficient(0), 1.0 / 6);
+    EXPECT_DOUBLE_EQ(starTriangles.localClusteringCoefficient(1), 1.0);
+    EXPECT_DOUBLE_EQ(starTriangles.localClusteringCoefficient(3), 0.0);
+    EXPECT_DOUBLE_EQ(starTriangles.globalClusteringCoefficient(), 3.0 / 8);
+    EXPECT_THROW(static_cast<void>(starTriangles.countAt(5)), std::invalid_argument);
+
+    EXPECT_EQ(graph::countTriangles(graph::AdjacencyListGraph(0)), 0);
+}
+
+TEST(triangle_counting, same_as_brute_force) { // NOLINT
+    auto g = randomGraph(400, 30, 17);
+    g.addEdge(3, 3); // self-loop
+    g.addEdge(3, 4); // probably parallel edges
+    g.addEdge(3, 4);
+    const auto expected = bruteForceTriangles(g);
+    uint64_t expectedTotal = 0;
+    for (const auto num : expected) expectedTotal += num;
+    expectedTotal /= 3;
+
+    for (const unsigned threads : {1u, 4u}) {
+        EXPECT_EQ(graph::countTriangles(g, threads), expectedTotal);
+        const graph::Triangles triangles(g, threads);
+        EXPECT_EQ(triangles.count(), expectedTotal);
+        EXPECT_EQ(triangles.countPerVertex(), expected);
+    }
+}
@@ -0,0 +1,182 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <functional>
+#include "Graph.h"
+#include "CsrGraph.h"
+#include "ParallelBfs.h"
+#include "MultiSourceBfs.h"
+#include "TriangleCounting.h"
+#include "ParallelConnectedComponents.h"
+#include "CompressedGraph.h"
+#include "GraphReordering.h"
+#include "GraphBetweenness.h"
+#include "BenchmarkHelpers.h"
+
+// Benchmarks for Graph.h algorithms on random graphs (build with -DCMAKE_BUILD_TYPE=Release for meaningful numbers)
+// Usage: unweighted_graph_benchmark [number of vertices] [average degree]
+
+// create graph with numV vertices and numV*avgDegree/2 random edges
+graph::AdjacencyListGraph randomGraph(const int numV, const int avgDegree) {
+    std::mt19937 gen(1234); // NOLINT
+    std::uniform_int_distribution<int> vertexDist(0, numV - 1);
+    graph::AdjacencyListGraph g(numV);
+    for (long long i = 0; i < static_cast<long long>(numV) * avgDegree / 2; ++i) {
+        g.addEdge(vertexDist(gen), vertexDist(gen));
+    }
+    return g;
+}
+
+// serial BFS vs. parallel BFS with increasing number of threads
+void benchmarkParallelBfs(const graph::Graph& g) {
+    using namespace graph::find_paths_to_all;
+    std::cout << "--- BFS from vertex 0: serial vs. level-synchronous parallel ---\n";
+    const double serialMs = timeMs([&] { fromVertexToAllBfs(g, 0); });
+    std::cout << "serial:              " << std::setw(10) << serialMs << " ms\n";
+    for (unsigned threads = 1; threads <= 2 * defaultNumThreads(); threads *= 2) {
+        const double parallelMs = timeMs([&] { fromVertexToAllBfsParallel(g, 0, threads); });
+        std::cout << "parallel, " << std::setw(3) << threads << " threads: " << std::setw(10) << parallelMs
+                  << " ms (speedup " << serialMs / parallelMs << ")\n";
+    }
+}
+
+// one BFS per source vs. bit-parallel multi-source BFS for a batch of sources
+void benchmarkMultiSourceBfs(const graph::Graph& g) {
+    using namespace graph;
+    std::cout << "--- Eccentricity of 256 sources: one BFS per source vs. multi-source BFS ---\n";
+    std::vector<int> sources{};
+    for (int i = 0; i < 256; ++i) sources.push_back(static_cast<int>((static_cast<long long>(i) * 7919) % g.V()));
+
+    // the largest eccentricity is printed, so that the timed loops cannot be optimized away
+    int maxEccentricity = 0;
+    const double serialMs = timeMs([&] {
+        maxEccentricity = 0;
+        for (const int s : sources) {
+            const auto result = find_paths_to_all::fromVertexToAllBfs(g, s);
+            for (int v = 0; v < g.V(); ++v) maxEccentricity = std::max(maxEccentricity, result.distanceTo(v));
+        }
+    }, 1);
+    std::cout << "one BFS per source:  " << std::setw(10) << serialMs << " ms (max. eccentricity " << maxEccentricity
+              << ")\n";
+    const auto maxOf = [](const std::vector<multi_source_bfs::SourceStatistics>& stats) {
+        int result = 0;
+        for (const auto& s : stats) result = std::max(result, s.eccentricity);
+        return result;
+    };
+    const double ms64Ms = timeMs([&] {
+        maxEccentricity = maxOf(multi_source_bfs::statisticsFromSources<1>(g, sources));
+    }, 1);
+    std::cout << "MS-BFS, 64 sources:  " << std::setw(10) << ms64Ms << " ms (speedup " << serialMs / ms64Ms
+              << ", max. eccentricity " << maxEccentricity << ")\n";
+    const double ms256Ms = timeMs([&] {
+        maxEccentricity = maxOf(multi_source_bfs::statisticsFromSources<4>(g, sources));
+    }, 1);
+    std::cout << "MS-BFS, 256 sources: " << std::setw(10) << ms256Ms << " ms (speedup " << serialMs / ms256Ms
+              << ", max. eccentricity " << maxEccentricity << ")\n";
+}
+
+// triangle counting with increasing number of threads
+void benchmarkTriangleCounting(const graph::Graph& g) {
+    std::cout << "--- Triangle counting with sorted-set intersection ---\n";
+    uint64_t triangles = 0;
+    const double oneThreadMs = timeMs([&] { triangles = graph::countTriangles(g, 1); });
+    std::cout << "1 thread:            " << std::setw(10) << oneThreadMs << " ms (" << triangles << " triangles)\n";
+    for (unsigned threads = 2; threads <= 2 * defaultNumThreads(); threads *= 2) {
+        const double parallelMs = timeMs([&] { triangles = graph::countTriangles(g, threads); });
+        std::cout << std::setw(3) << threads << " threads:         " << std::setw(10) << parallelMs
+                  << " ms (speedup " << oneThreadMs / parallelMs << ")\n";
+    }
+}
+
+// serial DFS vs. parallel Afforest connected components with increasing number of threads
+void benchmarkConnectedComponents(const graph::Graph& g) {
+    std::cout << "--- Connected components: serial DFS vs. parallel Afforest ---\n";
+    const double serialMs = timeMs([&] { graph::ConnectedComponents{g}; });
+    std::cout << "serial:              " << std::setw(10) << serialMs << " ms\n";
+    for (unsigned threads = 1; threads <= 2 * defaultNumThreads(); threads *= 2) {
+        const double parallelMs = timeMs([&] { graph::connectedComponentsParallel(g, threads); });
+        std::cout << "parallel, " << std::setw(3) << threads << " threads: " << std::setw(10) << parallelMs
+                  << " ms (speedup " << serialMs / parallelMs << ")\n";
+    }
+}
+
+// approximate betweenness centrality from 64 sampled sources with increasing number of threads
+void benchmarkBetweenness(const graph::Graph& g) {
+    std::cout << "--- Approximate betweenness centrality (Brandes, 64 sources) ---\n";
+    const double oneThreadMs = timeMs([&] { graph::approximateBetweennessCentrality(g, 64, 1); }, 1);
+    std::cout << "1 thread:            " << std::setw(10) << oneThreadMs << " ms\n";
+    for (unsigned threads = 2; threads <= 2 * defaultNumThreads(); threads *= 2) {
+        const double parallelMs = timeMs([&] { graph::approximateBetweennessCentrality(g, 64, threads); }, 1);
+        std::cout << std::setw(3) << threads << " threads:         " << std::setw(10) << parallelMs
+                  << " ms (speedup " << oneThreadMs / parallelMs << ")\n";
+    }
+}
+
+// algorithm templates instantiated for the virtual interface vs. for the concrete graph types (see GraphConcept.h)
+void benchmarkDevirtualization(const graph::AdjacencyListGraph& adjListGraph) {
+    using namespace graph;
+    std::cout << "--- Virtual graph interface vs. concrete graph types ---\n";
+    const CsrGraph csrGraph(adjListGraph);
+    const Graph& g = adjListGraph;
+    const auto compare = [](const std::string& name, const std::function<void()>& viaInterface,
+                            const std::function<void()>& viaAdjList, const std::function<void()>& viaCsr) {
+        const double interfaceMs = timeMs(viaInterface);
+        const double adjListMs = timeMs(viaAdjList);
+        const double csrMs = timeMs(viaCsr);
+        std::cout << name << " Graph&: " << std::setw(10) << interfaceMs << " ms, AdjacencyListGraph: "
+                  << std::setw(10) << adjListMs << " ms (speedup " << interfaceMs / adjListMs << "), CsrGraph: "
+                  << std::setw(10) << csrMs << " ms (speedup " << interfaceMs / csrMs << ")\n";
+    };
+    compare("BFS:        ",
+            [&] { find_paths_to_all::fromVertexToAllBfs(g, 0); },
+            [&] { find_paths_to_all::fromVertexToAllBfs(adjListGraph, 0); },
+            [&] { find_paths_to_all::fromVertexToAllBfs(csrGraph, 0); });
+    compare("components: ",
+            [&] { ConnectedComponents{g}; },
+            [&] { ConnectedComponents{adjListGraph}; },
+            [&] { ConnectedComponents{csrGraph}; });
+    compare("bipartite:  ",
+            [&] { static_cast<void>(isBipartite(g)); },
+            [&] { static_cast<void>(isBipartite(adjListGraph)); },
+            [&] { static_cast<void>(isBipartite(csrGraph)); });
+}
+
+// memory and traversal time of CSR vs. varint-compressed adjacencies, with and without reordering
+void benchmarkCompressedGraph(const graph::Graph& g) {
+    using namespace graph;
+    std::cout << "--- CsrGraph vs. CompressedGraph (varint-encoded gaps) ---\n";
+    const auto report = [](const std::string& name, const CsrGraph& csr) {
+        const CompressedGraph compressed(csr);
+        const size_t csrBytes = (static_cast<size_t>(csr.V()) + 1) * sizeof(size_t) + 2 * static_cast<size_t>(csr.E()) * sizeof(int);
+        const double csrBfsMs = timeMs([&] { find_paths_to_all::fromVertexToAllBfs(csr, 0); });
+        const double compressedBfsMs = timeMs([&] { find_paths_to_all::fromVertexToAllBfs(compressed, 0); });
+        const double csrCcMs = timeMs([&] { ConnectedComponents{csr}; });
+        const double compressedCcMs = timeMs([&] { ConnectedComponents{compressed}; });
+        const size_t adjListBytes = static_cast<size_t>(csr.V()) * sizeof(std::vector<int>) + 2 * static_cast<size_t>(csr.E()) * sizeof(int);
+        std::cout << name << "adjacency lists >= " << adjListBytes / 1048576.0 << " MiB, CSR " << csrBytes / 1048576.0 << " MiB, compressed " << compressed.memoryBytes() / 1048576.0
+                  << " MiB (ratio " << static_cast<double>(csrBytes) / static_cast<double>(compressed.memoryBytes())
+                  << ")\n" << name << "BFS " << csrBfsMs << " ms vs. " << compressedBfsMs << " ms, components "
+                  << csrCcMs << " ms vs. " << compressedCcMs << " ms\n";
+    };
+    report("original IDs: ", CsrGraph(g));
+    report("RCM order:    ", relabel(g, computeVertexOrder(g, VertexOrder::ReverseCuthillMcKee)));
+}
+
+int main(int argc, char* argv[]) {
+    const int numV = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const int avgDegree = argc > 2 ? std::stoi(argv[2]) : 16;
+    std::cout << "Creating random graph with " << numV << " vertices and average degree " << avgDegree << "\n";
+    const auto g = randomGraph(numV, avgDegree);
+    std::cout << std::fixed << std::setprecision(2);
+
+    benchmarkParallelBfs(g);
+    benchmarkMultiSourceBfs(g);
+    benchmarkTriangleCounting(g);
+    benchmarkConnectedComponents(g);
+    benchmarkBetweenness(g);
+    benchmarkDevirtualization(g);
+    benchmarkCompressedGraph(g);
+
+    return 0;
+}
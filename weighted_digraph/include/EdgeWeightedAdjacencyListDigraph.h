@@ -2,6 +2,7 @@
 #define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDADJACENCYLISTDIGRAPH_H
 
 #include "EdgeWeightedDigraph.h"
+#include "EdgeList.h"
 
 class EdgeWeightedAdjacencyListDigraph : public EdgeWeightedDigraph {
 public:
@@ -24,6 +25,19 @@ public:
         }
     }
 
+    // create digraph from a weighted edge list (see EdgeListLoader.h) with exactly reserved adjacency vectors
+    explicit EdgeWeightedAdjacencyListDigraph(const EdgeList& edgeList)
+            : numV(edgeList.numV), numE(edgeList.numE), edgesByVertex(edgeList.numV, std::vector<DirectedEdge>{}) {
+        if (!edgeList.hasWeights) throw std::invalid_argument("Edge list has no weights");
+        for (int v = 0; v < numV; ++v) {
+            edgesByVertex[v].reserve(edgeList.outDegree[v]);
+        }
+        for (int i = 0; i < numE; ++i) {
+            const int fromVertex = edgeList.endpoints[2 * i];
+            edgesByVertex[fromVertex].emplace_back(DirectedEdge(fromVertex, edgeList.endpoints[2 * i + 1], edgeList.weights[i]));
+        }
+    }
+
     void addEdge(const DirectedEdge &e) override {
         const int vertexFrom = e.from();
         const int vertexTo = e.to();
@@ -36,11 +50,17 @@ public:
     }
 
     [[nodiscard]]
-    const std::vector<DirectedEdge>& adj(int v) const override {
+    ArrayView<DirectedEdge> adj(int v) const override {
         if(!validVertex(v)) throw std::invalid_argument("Invalid vertex ID");
         return edgesByVertex[v];
     }
 
+    // get all edges from vertex v without bounds check (non-virtual, see GraphConcept.h)
+    [[nodiscard]]
+    ArrayView<DirectedEdge> adjUnchecked(int v) const {
+        return edgesByVertex[v];
+    }
+
     [[nodiscard]]
     std::vector<DirectedEdge> edges() const override {
         std::vector<DirectedEdge> result;
@@ -69,6 +89,7 @@ private:
     int numE {};
     std::vector<std::vector<DirectedEdge>> edgesByVertex {};
 
+protected:
     [[nodiscard]]
     bool validVertex(int v) const {
         return v >= 0 && static_cast<size_t>(v) < edgesByVertex.size();
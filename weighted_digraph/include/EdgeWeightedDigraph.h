@@ -5,6 +5,7 @@
 #include <ostream>
 #include <cmath>
 #include "DirectedEdge.h"
+#include "ArrayView.h"
 
 class EdgeWeightedDigraph {
 public:
@@ -13,7 +14,7 @@ public:
 
     // get all edges from vertex v
     [[nodiscard]]
-    virtual const std::vector<DirectedEdge>& adj(int v) const = 0;
+    virtual ArrayView<DirectedEdge> adj(int v) const = 0;
 
     // get all edges in graph
     [[nodiscard]]
@@ -31,7 +32,7 @@ public:
     virtual ~EdgeWeightedDigraph() = default;
 };
 
-std::ostream& operator<<(std::ostream &os, const EdgeWeightedDigraph& graph) {
+inline std::ostream& operator<<(std::ostream &os, const EdgeWeightedDigraph& graph) {
     os<<"EdgeWeightedDigraph (V="<<graph.V()<<", E="<<graph.E()<<")\n";
     for(int i=0; i<graph.V(); ++i) {
         os<<"Vertex "<<i<<": ";
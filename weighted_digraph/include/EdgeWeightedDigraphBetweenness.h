@@ -0,0 +1,21 @@
+#ifndef WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHBETWEENNESS_H
+#define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHBETWEENNESS_H
+
+#include "EdgeWeightedDigraph.h"
+#include "BetweennessCentrality.h"
+
+// betweenness centrality of every vertex with Brandes' algorithm over Dijkstra's shortest paths (see
+// BetweennessCentrality.h) in O(VE log V) on numThreads threads (0: default number of threads)
+// All edge weights must be positive; paths count as equally short if their summed weights are exactly equal.
+inline std::vector<double> betweennessCentrality(const EdgeWeightedDigraph& digraph, const unsigned numThreads = 0) {
+    return internal::weightedBetweenness(digraph, internal::allSources, 0, numThreads);
+}
+
+// estimate of the betweenness centrality from numSamples random sources (with random generator seed), which
+// takes O(numSamples*E log V) instead of O(VE log V)
+inline std::vector<double> approximateBetweennessCentrality(const EdgeWeightedDigraph& digraph, const int numSamples,
+                                                            const unsigned numThreads = 0, const uint32_t seed = 1234) {
+    return internal::weightedBetweenness(digraph, numSamples, seed, numThreads);
+}
+
+#endif //WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHBETWEENNESS_H
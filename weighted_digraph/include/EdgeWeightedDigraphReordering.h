@@ -0,0 +1,63 @@
+#ifndef WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHREORDERING_H
+#define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHREORDERING_H
+
+#include <algorithm>
+#include "EdgeWeightedAdjacencyListDigraph.h"
+#include "SingleSourceShortestPath.h"
+#include "VertexReordering.h"
+
+// adjacencies of digraph without directions (v->w as v->w and w->v) as compressed sparse rows
+inline CompressedSparseRows toSymmetricRows(const EdgeWeightedDigraph& digraph) {
+    std::vector<int> endpoints{};
+    endpoints.reserve(2 * static_cast<size_t>(digraph.E()));
+    for (int v = 0; v < digraph.V(); ++v) {
+        for (const auto& edge : digraph.adj(v)) {
+            endpoints.push_back(edge.from());
+            endpoints.push_back(edge.to());
+        }
+    }
+    return CompressedSparseRows::fromEndpoints(digraph.V(), endpoints, true);
+}
+
+// compute a cache-friendly vertex order of digraph, ignoring edge directions (see VertexReordering.h)
+inline VertexPermutation computeVertexOrder(const EdgeWeightedDigraph& digraph, const VertexOrder order) {
+    return computeVertexOrder(toSymmetricRows(digraph), order);
+}
+
+// copy of digraph where vertex v is called permutation.toNew(v)
+// the edges of each vertex are sorted by the new IDs of their end vertices
+inline EdgeWeightedAdjacencyListDigraph relabel(const EdgeWeightedDigraph& digraph, const VertexPermutation& permutation) {
+    if (permutation.size() != digraph.V()) throw std::invalid_argument("Permutation does not match digraph");
+    EdgeWeightedAdjacencyListDigraph result(digraph.V());
+    std::vector<DirectedEdge> edges{};
+    for (int newId = 0; newId < digraph.V(); ++newId) {
+        edges.clear();
+        for (const auto& edge : digraph.adj(permutation.toOld(newId))) {
+            edges.emplace_back(newId, permutation.toNew(edge.to()), edge.weight());
+        }
+        std::stable_sort(edges.begin(), edges.end(), [](const DirectedEdge& lhs, const DirectedEdge& rhs) {
+            return lhs.to() < rhs.to();
+        });
+        for (const auto& edge : edges) {
+            result.addEdge(edge);
+        }
+    }
+    return result;
+}
+
+// Shortest paths found in a digraph relabeled with a permutation, translated back to the original vertex IDs
+class RelabeledSingleSourceShortestPath : public SingleSourceShortestPath {
+public:
+    RelabeledSingleSourceShortestPath(const SingleSourceShortestPath& result, const VertexPermutation& permutation)
+            : SingleSourceShortestPath(permutation.size()) {
+        for (int newId = 0; newId < permutation.size(); ++newId) {
+            const int oldId = permutation.toOld(newId);
+            distancesTo[oldId] = result.distTo(newId);
+            if (const auto& edge = result.edgeTo(newId)) {
+                edgesTo[oldId] = DirectedEdge(permutation.toOld(edge->from()), oldId, edge->weight());
+            }
+        }
+    }
+};
+
+#endif //WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHREORDERING_H
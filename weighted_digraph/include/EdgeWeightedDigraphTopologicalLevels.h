@@ -0,0 +1,14 @@
+#ifndef WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHTOPOLOGICALLEVELS_H
+#define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHTOPOLOGICALLEVELS_H
+
+#include "EdgeWeightedDigraph.h"
+#include "TopologicalLevels.h"
+
+// topological sort of digraph split into levels of mutually independent vertices with Kahn's algorithm (see
+// TopologicalLevels.h) on numThreads threads (0: default number of threads)
+// If digraph has a cycle, the result is not acyclic() and contains one cycle() instead of all vertices.
+inline TopologicalLevels topologicalLevels(const EdgeWeightedDigraph& digraph, const unsigned numThreads = 0) {
+    return {digraph, [](const DirectedEdge& e) { return e.to(); }, numThreads};
+}
+
+#endif //WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDDIGRAPHTOPOLOGICALLEVELS_H
@@ -0,0 +1,62 @@
+#ifndef WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDINCREMENTALTOPOLOGICALORDER_H
+#define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDINCREMENTALTOPOLOGICALORDER_H
+
+#include "EdgeWeightedAdjacencyListDigraph.h"
+#include "DynamicTopologicalOrder.h"
+
+// Weighted DAG with adjacency lists which keeps a topological order up to date while edges are added
+// (Pearce-Kelly, see DynamicTopologicalOrder.h), instead of running topologicalSort after each change
+// Edges which would close a cycle are rejected and not added.
+class IncrementalTopologicalOrderEdgeWeightedDigraph : public EdgeWeightedAdjacencyListDigraph {
+public:
+    // create digraph with V vertices
+    explicit IncrementalTopologicalOrderEdgeWeightedDigraph(const int V) :
+            EdgeWeightedAdjacencyListDigraph(V), topological(V) {}
+
+    // create digraph with input stream (must be acyclic)
+    explicit IncrementalTopologicalOrderEdgeWeightedDigraph(std::istream& is) :
+            EdgeWeightedAdjacencyListDigraph(is), topological(asAdjacencyList(), targetOf) {}
+
+    // create digraph from a weighted edge list (see EdgeListLoader.h, must be acyclic)
+    explicit IncrementalTopologicalOrderEdgeWeightedDigraph(const EdgeList& edgeList) :
+            EdgeWeightedAdjacencyListDigraph(edgeList), topological(asAdjacencyList(), targetOf) {}
+
+    // add edge e to digraph and update the topological order, or throw if e would close a cycle
+    void addEdge(const DirectedEdge& e) override {
+        if (!tryAddEdge(e)) throw std::invalid_argument("Edge would create a cycle");
+    }
+
+    // add edge e to digraph and update the topological order and return true, or return false without changes
+    // if e would close a cycle
+    bool tryAddEdge(const DirectedEdge& e) {
+        if (!validVertex(e.from()) || !validVertex(e.to())) throw std::invalid_argument("Vertex IDs invalid");
+        if (!topological.insert(asAdjacencyList(), e.from(), e.to(), targetOf)) return false;
+        EdgeWeightedAdjacencyListDigraph::addEdge(e);
+        return true;
+    }
+
+    // all vertices in topological order
+    [[nodiscard]] const std::vector<int>& topologicalOrder() const {
+        return topological.order();
+    }
+
+    // position of v in the topological order
+    [[nodiscard]] int position(const int v) const {
+        if (!validVertex(v)) throw std::invalid_argument("Invalid vertex ID");
+        return topological.positionOf(v);
+    }
+
+private:
+    internal::DynamicTopologicalOrder topological;
+
+    static int targetOf(const DirectedEdge& e) {
+        return e.to();
+    }
+
+    // this digraph with non-virtual adjacencies for the searches
+    [[nodiscard]] const EdgeWeightedAdjacencyListDigraph& asAdjacencyList() const {
+        return *this;
+    }
+};
+
+#endif //WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDINCREMENTALTOPOLOGICALORDER_H
@@ -0,0 +1,84 @@
+#ifndef WEIGHTED_GRAPHS_CPP_MAPPEDEDGEWEIGHTEDDIGRAPH_H
+#define WEIGHTED_GRAPHS_CPP_MAPPEDEDGEWEIGHTEDDIGRAPH_H
+
+#include <type_traits>
+#include "EdgeWeightedDigraph.h"
+#include "GraphSnapshot.h"
+
+// the entries of the snapshot are used as DirectedEdge objects directly
+static_assert(sizeof(DirectedEdge) == sizeof(SnapshotEdgeEntry) && alignof(DirectedEdge) <= alignof(SnapshotEdgeEntry),
+              "DirectedEdge must have the same layout as SnapshotEdgeEntry");
+static_assert(std::is_trivially_copyable_v<DirectedEdge> && std::is_standard_layout_v<DirectedEdge>,
+              "DirectedEdge must be trivially copyable");
+
+// write binary snapshot of digraph to path (see GraphSnapshot.h), which can be opened with MappedEdgeWeightedDigraph
+inline void writeSnapshot(const EdgeWeightedDigraph& digraph, const std::string& path) {
+    writeSnapshotFile(path, SnapshotType::EdgeWeightedDigraph, digraph.V(), digraph.E(),
+                      [&](const int v) { return digraph.adj(v).size(); },
+                      [&](const int v, const auto& write) {
+                          for (const auto& edge : digraph.adj(v)) {
+                              write(SnapshotEdgeEntry{edge.from(), edge.to(), edge.weight()});
+                          }
+                      });
+}
+
+// Immutable edge-weighted digraph which uses a memory-mapped snapshot file directly (zero-copy)
+// Opening maps the file and checks its header and row offsets in O(V), but not the adjacencies. Call validate()
+// before using a file which may be corrupt, as invalid vertices in it lead to undefined behavior.
+// The pages are loaded on first access and shared with all other processes which map the same file.
+class MappedEdgeWeightedDigraph : public EdgeWeightedDigraph {
+public:
+    // map snapshot at path (created with writeSnapshot)
+    explicit MappedEdgeWeightedDigraph(const std::string& path)
+            : file(path, SnapshotType::EdgeWeightedDigraph), offsets(file.rowOffsets()),
+              edgesOfAllVertices(file.entries<DirectedEdge>()) {}
+
+    // mapped digraphs cannot be changed
+    void addEdge(const DirectedEdge&) override {
+        throw std::logic_error("MappedEdgeWeightedDigraph is immutable");
+    }
+
+    [[nodiscard]]
+    ArrayView<DirectedEdge> adj(int v) const override {
+        if(!validVertex(v)) throw std::invalid_argument("Invalid vertex ID");
+        return {edgesOfAllVertices.data() + offsets[v], static_cast<size_t>(offsets[v + 1] - offsets[v])};
+    }
+
+    // get all edges from vertex v without bounds check (non-virtual, see GraphConcept.h)
+    [[nodiscard]]
+    ArrayView<DirectedEdge> adjUnchecked(int v) const {
+        return {edgesOfAllVertices.data() + offsets[v], static_cast<size_t>(offsets[v + 1] - offsets[v])};
+    }
+
+    [[nodiscard]]
+    std::vector<DirectedEdge> edges() const override {
+        return edgesOfAllVertices.toVector();
+    }
+
+    [[nodiscard]]
+    int V() const override {
+        return file.V();
+    }
+
+    [[nodiscard]]
+    int E() const override {
+        return file.E();
+    }
+
+    // check the whole file for invalid offsets or vertices in O(V+E)
+    void validate() const {
+        file.validateRows();
+    }
+
+private:
+    SnapshotFile file; // mapped snapshot
+    ArrayView<uint64_t> offsets; // start of each row in edgesOfAllVertices (V+1 elements)
+    ArrayView<DirectedEdge> edgesOfAllVertices; // edges of all vertices, ordered by start vertex
+
+    [[nodiscard]]
+    bool validVertex(int v) const {
+        return v >= 0 && v < file.V();
+    }
+};
+
+#endif //WEIGHTED_GRAPHS_CPP_MAPPEDEDGEWEIGHTEDDIGRAPH_H
@@ -2,11 +2,14 @@
 #define GRAPHS_CPP_SINGLESOURCEBELLMANFORDSHORTESTPATH_H
 
 #include "SingleSourceShortestPath.h"
+#include "GraphConcept.h"
 
 class SingleSourceBellmanFordShortestPath : public SingleSourceShortestPath {
 public:
-    SingleSourceBellmanFordShortestPath(const EdgeWeightedDigraph &digraph, const int from) :
-            SingleSourceShortestPath(digraph) {
+    // shortest paths from vertex from in digraph (for all weighted digraph types, see GraphConcept.h)
+    template<typename DG, EnableIfGraphLike<DG> = 0>
+    SingleSourceBellmanFordShortestPath(const DG &digraph, const int from) :
+            SingleSourceShortestPath(digraph.V()) {
 
         // Bellman-Ford: relax all edges V^2 times
         // optimization possible: keep queue of all vertices for which distancesTo[v] changed, and only iterate through
@@ -15,7 +18,7 @@ public:
 
         for(int i=0; i < digraph.V(); ++i) {
             for(int v=0; v < digraph.V(); ++v) {
-                for(const auto& edge : digraph.adj(v)) {
+                for(const auto& edge : uncheckedAdj(digraph, v)) {
                     relax(edge);
                 }
             }
@@ -23,7 +26,7 @@ public:
 
         // check for negative cycle
         for(int v=0; v < digraph.V(); ++v) {
-            for(const auto& edge : digraph.adj(v)) {
+            for(const auto& edge : uncheckedAdj(digraph, v)) {
                 if (distancesTo[edge.to()] > distancesTo[edge.from()] + edge.weight()) {
                     // negative cycle
                     std::cout<<std::flush;
@@ -3,11 +3,14 @@
 
 #include "IndexedPriorityQueue.h"
 #include "SingleSourceShortestPath.h"
+#include "GraphConcept.h"
 
 class SingleSourceDijkstraShortestPath : public SingleSourceShortestPath {
 public:
-    SingleSourceDijkstraShortestPath(const EdgeWeightedDigraph &digraph, const int from) :
-            SingleSourceShortestPath(digraph) {
+    // shortest paths from vertex from in digraph (for all weighted digraph types, see GraphConcept.h)
+    template<typename DG, EnableIfGraphLike<DG> = 0>
+    SingleSourceDijkstraShortestPath(const DG &digraph, const int from) :
+            SingleSourceShortestPath(digraph.V()) {
 
         // Dijkstra's algorithm (assumes non-negative edge weights)
         distancesTo[from] = 0;
@@ -16,7 +19,7 @@ public:
         pq.insert(from, 0.0);
         while(!pq.empty()) {
             const int v = pq.removeFirst();
-            for(const auto& edge : digraph.adj(v)) {
+            for(const auto& edge : uncheckedAdj(digraph, v)) {
                 relax(edge, pq);
             }
         }
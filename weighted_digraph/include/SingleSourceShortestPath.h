@@ -38,13 +38,22 @@ public:
         return std::isfinite(distancesTo[to]);
     }
 
+    // last edge on the shortest path to vertex to (if any)
+    [[nodiscard]]
+    const std::optional<DirectedEdge>& edgeTo(const int to) const {
+        checkIndex(to);
+        return edgesTo[to];
+    }
+
 protected:
     std::vector<std::optional<DirectedEdge>> edgesTo; // edge used to step to this vertex
     std::vector<double> distancesTo; // distance from start to this vertex
 
-    explicit SingleSourceShortestPath(const EdgeWeightedDigraph& digraph) :
-            edgesTo(digraph.V(), std::nullopt),
-            distancesTo(digraph.V(), std::numeric_limits<double>::infinity() // inf distance by default
+    explicit SingleSourceShortestPath(const EdgeWeightedDigraph& digraph) : SingleSourceShortestPath(digraph.V()) {}
+
+    explicit SingleSourceShortestPath(const int V) :
+            edgesTo(V, std::nullopt),
+            distancesTo(V, std::numeric_limits<double>::infinity() // inf distance by default
             ) {}
 
     void checkIndex(const int v) const {
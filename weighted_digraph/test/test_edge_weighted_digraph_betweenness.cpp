@@ -0,0 +1,30 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include "EdgeWeightedAdjacencyListDigraph.h"
+#include "EdgeWeightedDigraphBetweenness.h"
+
+TEST(edge_weighted_digraph_betweenness, weights_decide_paths) { // NOLINT
+    // 0->1->3 (weight 2) and 0->2->3 (weight 2) tie, the direct edge 0->3 is longer
+    EdgeWeightedAdjacencyListDigraph dg(4);
+    dg.addEdge(DirectedEdge(0, 1, 1.0));
+    dg.addEdge(DirectedEdge(1, 3, 1.0));
+    dg.addEdge(DirectedEdge(0, 2, 0.5));
+    dg.addEdge(DirectedEdge(2, 3, 1.5));
+    dg.addEdge(DirectedEdge(0, 3, 2.5));
+    EXPECT_EQ(betweennessCentrality(dg), (std::vector<double>{0, 0.5, 0.5, 0}));
+
+    // a shorter direct edge takes all paths away
+    dg.addEdge(DirectedEdge(0, 3, 1.0));
+    EXPECT_EQ(betweennessCentrality(dg, 2), (std::vector<double>{0, 0, 0, 0}));
+
+    dg.addEdge(DirectedEdge(3, 0, 0.0));
+    EXPECT_THROW(betweennessCentrality(dg), std::invalid_argument);
+}
+
+TEST(edge_weighted_digraph_betweenness, unit_weights_like_unweighted) { // NOLINT
+    // path 0->1->2->3 with unit weights
+    EdgeWeightedAdjacencyListDigraph dg(4);
+    for (int v = 0; v < 3; ++v) dg.addEdge(DirectedEdge(v, v + 1, 1.0));
+    EXPECT_EQ(betweennessCentrality(dg), (std::vector<double>{0, 2, 2, 0}));
+    EXPECT_EQ(approximateBetweennessCentrality(dg, 4, 2), (std::vector<double>{0, 2, 2, 0}));
+}
@@ -0,0 +1,30 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include "EdgeWeightedDigraphReordering.h"
+#include "SingleSourceDijkstraShortestPath.h"
+
+// digraph source of tinyEWD.txt
+static const char* tinyEWDReordering = "8 15\n4 5 0.35\n5 4 0.35\n4 7 0.37\n5 7 0.28\n7 5 0.28\n5 1 0.32\n0 4 0.38\n"
+                                       "0 2 0.26\n7 3 0.37\n1 3 0.29\n2 7 0.34\n6 2 0.40\n3 6 0.52\n6 0 0.58\n6 4 0.93\n";
+
+TEST(edge_weighted_digraph_reordering, shortest_paths_in_original_ids) { // NOLINT
+    std::istringstream iss(tinyEWDReordering);
+    const EdgeWeightedAdjacencyListDigraph digraph(iss);
+    const auto permutation = computeVertexOrder(digraph, VertexOrder::ReverseCuthillMcKee);
+    const auto relabeled = relabel(digraph, permutation);
+    EXPECT_EQ(relabeled.E(), 15);
+
+    const SingleSourceDijkstraShortestPath expected(digraph, 0);
+    const RelabeledSingleSourceShortestPath translated(
+            SingleSourceDijkstraShortestPath(relabeled, permutation.toNew(0)), permutation);
+    for (int v = 0; v < digraph.V(); ++v) {
+        EXPECT_DOUBLE_EQ(translated.distTo(v), expected.distTo(v));
+        const auto path = translated.pathTo(v);
+        const auto expectedPath = expected.pathTo(v);
+        ASSERT_EQ(path.size(), expectedPath.size());
+        for (size_t i = 0; i < path.size(); ++i) {
+            EXPECT_EQ(path[i].from(), expectedPath[i].from());
+            EXPECT_EQ(path[i].to(), expectedPath[i].to());
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include "EdgeWeightedAdjacencyListDigraph.h"
+#include "TopologicalSort.h"
+#include "EdgeWeightedDigraphTopologicalLevels.h"
+#include "EdgeWeightedIncrementalTopologicalOrder.h"
+#include "SingleSourceAcyclicShortestPath.h"
+
+TEST(edge_weighted_topological_sort, dag_and_cycle) { // NOLINT
+    // 0->2, 0->1, 1->2, 2->3
+    EdgeWeightedAdjacencyListDigraph dg(4);
+    dg.addEdge(DirectedEdge(0, 2, 5.0));
+    dg.addEdge(DirectedEdge(0, 1, 1.0));
+    dg.addEdge(DirectedEdge(1, 2, 1.0));
+    dg.addEdge(DirectedEdge(2, 3, 1.0));
+    EXPECT_FALSE(containsCycle(dg).has_value());
+    EXPECT_EQ(topologicalSort(dg), (std::vector<int>{0, 1, 2, 3}));
+    const SingleSourceAcyclicShortestPath sp(dg, 0);
+    EXPECT_DOUBLE_EQ(sp.distTo(3), 3.0);
+
+    dg.addEdge(DirectedEdge(3, 1, 1.0));
+    EXPECT_EQ(containsCycle(dg), (std::vector<int>{1, 2, 3, 1})); // 0->2 is visited first
+    EXPECT_THROW((void) topologicalSort(dg), std::invalid_argument);
+}
+
+TEST(edge_weighted_topological_sort, deep) { // NOLINT
+    // a long path would overflow the call stack of a recursive DFS
+    constexpr int V = 1'000'000;
+    EdgeWeightedAdjacencyListDigraph dg(V);
+    for (int v = 0; v + 1 < V; ++v) dg.addEdge(DirectedEdge(v, v + 1, 1.0));
+    const auto order = topologicalSort(dg);
+    ASSERT_EQ(order.size(), static_cast<size_t>(V));
+    EXPECT_EQ(order.front(), 0);
+    EXPECT_EQ(order.back(), V - 1);
+}
+
+TEST(edge_weighted_topological_sort, levels) { // NOLINT
+    // 0->1, 0->2, 1->3, 2->3, 3->4
+    EdgeWeightedAdjacencyListDigraph dg(5);
+    dg.addEdge(DirectedEdge(0, 1, 1.0));
+    dg.addEdge(DirectedEdge(0, 2, 1.0));
+    dg.addEdge(DirectedEdge(1, 3, 1.0));
+    dg.addEdge(DirectedEdge(2, 3, 1.0));
+    dg.addEdge(DirectedEdge(3, 4, 1.0));
+    const auto levels = topologicalLevels(dg, 2);
+    EXPECT_TRUE(levels.acyclic());
+    EXPECT_EQ(levels.order(), (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(levels.levelBoundaries(), (std::vector<size_t>{0, 1, 3, 4, 5}));
+
+    dg.addEdge(DirectedEdge(4, 0, 1.0));
+    const auto withCycle = topologicalLevels(dg);
+    EXPECT_FALSE(withCycle.acyclic());
+    EXPECT_TRUE(withCycle.order().empty());
+    EXPECT_EQ(withCycle.cycle(), (std::vector<int>{4, 0, 1, 3, 4}));
+}
+
+TEST(edge_weighted_topological_sort, incremental) { // NOLINT
+    IncrementalTopologicalOrderEdgeWeightedDigraph dg(4);
+    dg.addEdge(DirectedEdge(2, 0, 1.0));
+    dg.addEdge(DirectedEdge(3, 2, 2.0));
+    EXPECT_EQ(dg.topologicalOrder(), (std::vector<int>{3, 1, 2, 0})); // 1 is not affected and stays in place
+    EXPECT_EQ(dg.position(1), 1);
+    EXPECT_FALSE(dg.tryAddEdge(DirectedEdge(0, 3, 1.0))); // 3->2->0->3
+    EXPECT_THROW(dg.addEdge(DirectedEdge(0, 2, 1.0)), std::invalid_argument);
+    EXPECT_THROW(dg.addEdge(DirectedEdge(0, 4, 1.0)), std::invalid_argument);
+    EXPECT_TRUE(dg.tryAddEdge(DirectedEdge(1, 3, 1.0)));
+    EXPECT_EQ(dg.E(), 3);
+    EXPECT_EQ(dg.topologicalOrder(), (std::vector<int>{1, 3, 2, 0}));
+    EXPECT_EQ(topologicalSort(dg), dg.topologicalOrder()); // the only topological order of 1->3->2->0
+}
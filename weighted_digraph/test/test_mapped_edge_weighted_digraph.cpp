@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <sstream>
+#include "EdgeWeightedAdjacencyListDigraph.h"
+#include "MappedEdgeWeightedDigraph.h"
+#include "SingleSourceDijkstraShortestPath.h"
+#include "SingleSourceBellmanFordShortestPath.h"
+
+// digraph source of tinyEWD.txt
+static const char* tinyEWD = "8 15\n4 5 0.35\n5 4 0.35\n4 7 0.37\n5 7 0.28\n7 5 0.28\n5 1 0.32\n0 4 0.38\n0 2 0.26\n"
+                             "7 3 0.37\n1 3 0.29\n2 7 0.34\n6 2 0.40\n3 6 0.52\n6 0 0.58\n6 4 0.93\n";
+
+TEST(mapped_edge_weighted_digraph, same_as_original) { // NOLINT
+    std::istringstream iss(tinyEWD);
+    const EdgeWeightedAdjacencyListDigraph original(iss);
+    const std::string path = "test_mapped_edge_weighted_digraph_tmp.bin";
+    writeSnapshot(original, path);
+    {
+        MappedEdgeWeightedDigraph mapped(path);
+        mapped.validate();
+        EXPECT_EQ(mapped.V(), 8);
+        EXPECT_EQ(mapped.E(), 15);
+        EXPECT_EQ(mapped.edges().size(), 15);
+        std::ostringstream expected, actual;
+        expected << original;
+        actual << mapped;
+        EXPECT_EQ(actual.str(), expected.str());
+        EXPECT_ANY_THROW(static_cast<void>(mapped.adj(8)));
+        EXPECT_THROW(mapped.addEdge(DirectedEdge(0, 1, 1.0)), std::logic_error);
+
+        // algorithms work on the mapped digraph directly
+        const SingleSourceDijkstraShortestPath fromMapped(mapped, 0);
+        const SingleSourceDijkstraShortestPath fromOriginal(original, 0);
+        const EdgeWeightedDigraph& mappedInterface = mapped; // virtual interface
+        const SingleSourceBellmanFordShortestPath bellmanFord(mappedInterface, 0);
+        for (int v = 0; v < 8; ++v) {
+            EXPECT_DOUBLE_EQ(fromMapped.distTo(v), fromOriginal.distTo(v));
+            EXPECT_DOUBLE_EQ(bellmanFord.distTo(v), fromOriginal.distTo(v));
+        }
+
+        // modifiable copy from the snapshot
+        const EdgeWeightedAdjacencyListDigraph copy(SnapshotFile(path, SnapshotType::EdgeWeightedDigraph).toEdgeList());
+        std::ostringstream copied;
+        copied << copy;
+        EXPECT_EQ(copied.str(), expected.str());
+    }
+    std::remove(path.c_str());
+}
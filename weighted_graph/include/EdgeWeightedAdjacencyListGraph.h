@@ -2,6 +2,7 @@
 #define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDADJACENCYLISTGRAPH_H
 
 #include "EdgeWeightedGraph.h"
+#include "EdgeList.h"
 
 class EdgeWeightedAdjacencyListGraph : public EdgeWeightedGraph {
 public:
@@ -25,6 +26,21 @@ public:
         }
     }
 
+    // create graph from a weighted edge list (see EdgeListLoader.h) with exactly reserved adjacency vectors
+    explicit EdgeWeightedAdjacencyListGraph(const EdgeList& edgeList)
+            : numV(edgeList.numV), numE(edgeList.numE), edgesByVertex(edgeList.numV, std::vector<Edge>{}) {
+        if (!edgeList.hasWeights) throw std::invalid_argument("Edge list has no weights");
+        for (int v = 0; v < numV; ++v) {
+            edgesByVertex[v].reserve(edgeList.outDegree[v] + edgeList.inDegree[v]);
+        }
+        for (int i = 0; i < numE; ++i) {
+            const int v = edgeList.endpoints[2 * i];
+            const int w = edgeList.endpoints[2 * i + 1];
+            edgesByVertex[v].emplace_back(Edge(v, w, edgeList.weights[i]));
+            edgesByVertex[w].emplace_back(Edge(v, w, edgeList.weights[i]));
+        }
+    }
+
     void addEdge(const Edge &e) override {
         const int v1 = e.either();
         const int v2 = e.other(v1);
@@ -0,0 +1,60 @@
+#ifndef WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDGRAPHREORDERING_H
+#define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDGRAPHREORDERING_H
+
+#include <algorithm>
+#include "EdgeWeightedAdjacencyListGraph.h"
+#include "VertexReordering.h"
+
+// adjacencies of graph as compressed sparse rows (already symmetric for undirected graphs)
+inline CompressedSparseRows toRows(const EdgeWeightedGraph& graph) {
+    std::vector<size_t> offsets(static_cast<size_t>(graph.V()) + 1, 0);
+    for (int v = 0; v < graph.V(); ++v) {
+        offsets[v + 1] = offsets[v] + graph.adj(v).size();
+    }
+    std::vector<int> targets{};
+    targets.reserve(offsets.back());
+    for (int v = 0; v < graph.V(); ++v) {
+        for (const auto& edge : graph.adj(v)) {
+            targets.push_back(edge.other(v));
+        }
+    }
+    return CompressedSparseRows(std::move(offsets), std::move(targets));
+}
+
+// compute a cache-friendly vertex order of graph (see VertexReordering.h)
+inline VertexPermutation computeVertexOrder(const EdgeWeightedGraph& graph, const VertexOrder order) {
+    return computeVertexOrder(toRows(graph), order);
+}
+
+// copy of graph where vertex v is called permutation.toNew(v)
+// edges are added by ascending new IDs of their endpoints
+inline EdgeWeightedAdjacencyListGraph relabel(const EdgeWeightedGraph& graph, const VertexPermutation& permutation) {
+    if (permutation.size() != graph.V()) throw std::invalid_argument("Permutation does not match graph");
+    std::vector<Edge> edges{};
+    edges.reserve(graph.E());
+    for (int v = 0; v < graph.V(); ++v) {
+        bool selfLoopOpen = false; // self-loops are in adj(v) twice
+        for (const auto& edge : graph.adj(v)) {
+            const int other = edge.other(v);
+            if (other < v) continue; // take each edge at its lower vertex only
+            if (other == v) {
+                selfLoopOpen = !selfLoopOpen;
+                if (!selfLoopOpen) continue;
+            }
+            const int newV = permutation.toNew(v);
+            const int newOther = permutation.toNew(other);
+            edges.emplace_back(std::min(newV, newOther), std::max(newV, newOther), edge.getWeight());
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const Edge& lhs, const Edge& rhs) {
+        const int lhsOther = lhs.other(lhs.either()), rhsOther = rhs.other(rhs.either());
+        return lhs.either() != rhs.either() ? lhs.either() < rhs.either() : lhsOther < rhsOther;
+    });
+    EdgeWeightedAdjacencyListGraph result(graph.V());
+    for (const auto& edge : edges) {
+        result.addEdge(edge);
+    }
+    return result;
+}
+
+#endif //WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDGRAPHREORDERING_H
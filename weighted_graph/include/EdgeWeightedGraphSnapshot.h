@@ -0,0 +1,25 @@
+#ifndef WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDGRAPHSNAPSHOT_H
+#define WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDGRAPHSNAPSHOT_H
+
+#include "EdgeWeightedAdjacencyListGraph.h"
+#include "GraphSnapshot.h"
+
+// write binary snapshot of graph to path (see GraphSnapshot.h)
+// every edge is saved in the rows of both of its vertices, like in EdgeWeightedAdjacencyListGraph
+inline void writeSnapshot(const EdgeWeightedGraph& graph, const std::string& path) {
+    writeSnapshotFile(path, SnapshotType::EdgeWeightedGraph, graph.V(), graph.E(),
+                      [&](const int v) { return graph.adj(v).size(); },
+                      [&](const int v, const auto& write) {
+                          for (const auto& edge : graph.adj(v)) {
+                              const int either = edge.either();
+                              write(SnapshotEdgeEntry{either, edge.other(either), edge.getWeight()});
+                          }
+                      });
+}
+
+// load graph from binary snapshot at path without parsing text
+inline EdgeWeightedAdjacencyListGraph loadEdgeWeightedGraphSnapshot(const std::string& path) {
+    return EdgeWeightedAdjacencyListGraph(SnapshotFile(path, SnapshotType::EdgeWeightedGraph).toEdgeList());
+}
+
+#endif //WEIGHTED_GRAPHS_CPP_EDGEWEIGHTEDGRAPHSNAPSHOT_H
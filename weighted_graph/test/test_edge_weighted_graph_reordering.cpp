@@ -0,0 +1,21 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include "EdgeWeightedGraphReordering.h"
+#include "MinimumSpanningTree.h"
+
+// graph source of tinyEWG.txt
+static const char* tinyEWGReordering = "8 16\n4 5 0.35\n4 7 0.37\n5 7 0.28\n0 7 0.16\n1 5 0.32\n0 4 0.38\n2 3 0.17\n"
+                                       "1 7 0.19\n0 2 0.26\n1 2 0.36\n1 3 0.29\n2 7 0.34\n6 2 0.40\n3 6 0.52\n6 0 0.58\n6 4 0.93\n";
+
+TEST(edge_weighted_graph_reordering, relabel) { // NOLINT
+    std::istringstream iss(tinyEWGReordering);
+    EdgeWeightedAdjacencyListGraph graph(iss);
+    graph.addEdge(Edge(2, 2, 1.5)); // self-loop
+    const auto permutation = computeVertexOrder(graph, VertexOrder::DegreeDescending);
+    const auto relabeled = relabel(graph, permutation);
+    EXPECT_EQ(relabeled.E(), 17);
+    for (int v = 0; v < graph.V(); ++v) {
+        EXPECT_EQ(relabeled.adj(permutation.toNew(v)).size(), graph.adj(v).size());
+    }
+    EXPECT_DOUBLE_EQ(MinimumSpanningTree(relabeled).weight(), MinimumSpanningTree(graph).weight());
+}
@@ -0,0 +1,35 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <sstream>
+#include <algorithm>
+#include "EdgeWeightedGraphSnapshot.h"
+
+// graph source of tinyEWG.txt
+static const char* tinyEWG = "8 16\n4 5 0.35\n4 7 0.37\n5 7 0.28\n0 7 0.16\n1 5 0.32\n0 4 0.38\n2 3 0.17\n1 7 0.19\n"
+                             "0 2 0.26\n1 2 0.36\n1 3 0.29\n2 7 0.34\n6 2 0.40\n3 6 0.52\n6 0 0.58\n6 4 0.93\n";
+
+TEST(edge_weighted_graph_snapshot, round_trip) { // NOLINT
+    std::istringstream iss(tinyEWG);
+    EdgeWeightedAdjacencyListGraph original(iss);
+    original.addEdge(Edge(3, 3, 0.5)); // self-loop
+    const std::string path = "test_edge_weighted_graph_snapshot_tmp.bin";
+    writeSnapshot(original, path);
+
+    const auto loaded = loadEdgeWeightedGraphSnapshot(path);
+    EXPECT_EQ(loaded.V(), 8);
+    EXPECT_EQ(loaded.E(), 17);
+    EXPECT_EQ(loaded.edges().size(), original.edges().size());
+    // same edges at every vertex (possibly in another order)
+    const auto sortedNeighbors = [](const EdgeWeightedGraph& g, const int v) {
+        std::vector<std::pair<int, double>> result;
+        for (const auto& edge : g.adj(v)) result.emplace_back(edge.other(v), edge.getWeight());
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+    for (int v = 0; v < 8; ++v) {
+        EXPECT_EQ(sortedNeighbors(loaded, v), sortedNeighbors(original, v));
+    }
+
+    EXPECT_THROW(SnapshotFile(path, SnapshotType::EdgeWeightedDigraph), std::runtime_error); // wrong type
+    std::remove(path.c_str());
+}